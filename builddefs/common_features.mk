@@ -464,6 +464,8 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/color.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_drivers.c
+    SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_layers.c
+    SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_correction.c
     LIB8TION_ENABLE := yes
     CIE1931_CURVE := yes
     RGB_KEYCODES_ENABLE := yes
@@ -18,6 +18,7 @@
 #include "aw20216s.h"
 #include "wait.h"
 #include "spi_master.h"
+#include "led/led_dirty.h"
 
 #define AW20216S_PWM_REGISTER_COUNT 216
 
@@ -47,12 +48,12 @@
 
 typedef struct aw20216s_driver_t {
     uint8_t pwm_buffer[AW20216S_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[LED_DIRTY_BITMAP_SIZE(AW20216S_PWM_REGISTER_COUNT)];
 } PACKED aw20216s_driver_t;
 
 aw20216s_driver_t driver_buffers[AW20216S_DRIVER_COUNT] = {{
     .pwm_buffer       = {0},
-    .pwm_buffer_dirty = false,
+    .pwm_buffer_dirty = {0},
 }};
 
 bool aw20216s_write(pin_t cs_pin, uint8_t page, uint8_t reg, uint8_t* data, uint8_t len) {
@@ -147,7 +148,9 @@ void aw20216s_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     driver_buffers[led.driver].pwm_buffer[led.r] = red;
     driver_buffers[led.driver].pwm_buffer[led.g] = green;
     driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-    driver_buffers[led.driver].pwm_buffer_dirty  = true;
+    led_dirty_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.r);
+    led_dirty_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.g);
+    led_dirty_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.b);
 }
 
 void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -157,9 +160,13 @@ void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void aw20216s_update_pwm_buffers(pin_t cs_pin, uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        aw20216s_write(cs_pin, AW20216S_PAGE_PWM, 0, driver_buffers[index].pwm_buffer, AW20216S_PWM_REGISTER_COUNT);
-        driver_buffers[index].pwm_buffer_dirty = false;
+    // Only send the runs of PWM registers that changed since the last flush
+    uint8_t i = 0;
+    uint8_t length;
+
+    while ((length = led_dirty_next_run(driver_buffers[index].pwm_buffer_dirty, AW20216S_PWM_REGISTER_COUNT, &i, AW20216S_PWM_REGISTER_COUNT)) > 0) {
+        aw20216s_write(cs_pin, AW20216S_PAGE_PWM, i, driver_buffers[index].pwm_buffer + i, length);
+        i += length;
     }
 }
 
@@ -169,3 +176,13 @@ void aw20216s_flush(void) {
     aw20216s_update_pwm_buffers(AW20216S_CS_PIN_2, 1);
 #endif
 }
+
+void aw20216s_sw_return_normal(pin_t cs_pin) {
+    // Setting LED driver to normal mode
+    aw20216s_soft_enable(cs_pin);
+}
+
+void aw20216s_sw_shutdown(pin_t cs_pin) {
+    // Setting LED driver to shutdown mode
+    aw20216s_write_register(cs_pin, AW20216S_PAGE_FUNCTION, AW20216S_FUNCTION_REG_CONFIGURATION, AW20216S_CONFIGURATION & ~AW20216S_CONFIGURATION_CHIPEN);
+}
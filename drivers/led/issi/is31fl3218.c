@@ -170,3 +170,13 @@ void is31fl3218_update_led_control_registers(void) {
         driver_buffers.led_control_buffer_dirty = false;
     }
 }
+
+void is31fl3218_sw_return_normal(void) {
+    // Setting LED driver to normal mode
+    is31fl3218_write_register(IS31FL3218_REG_SHUTDOWN, 0x01);
+}
+
+void is31fl3218_sw_shutdown(void) {
+    // Setting LED driver to shutdown mode
+    is31fl3218_write_register(IS31FL3218_REG_SHUTDOWN, 0x00);
+}
@@ -57,6 +57,9 @@ void is31fl3218_update_pwm_buffers(void);
 
 void is31fl3218_update_led_control_registers(void);
 
+void is31fl3218_sw_return_normal(void);
+void is31fl3218_sw_shutdown(void);
+
 #define OUT1 0x00
 #define OUT2 0x01
 #define OUT3 0x02
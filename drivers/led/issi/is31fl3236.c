@@ -170,3 +170,13 @@ void is31fl3236_flush(void) {
         is31fl3236_update_pwm_buffers(i);
     }
 }
+
+void is31fl3236_sw_return_normal(uint8_t index) {
+    // Setting LED driver to normal mode
+    is31fl3236_write_register(index, IS31FL3236_REG_SHUTDOWN, 0x01);
+}
+
+void is31fl3236_sw_shutdown(uint8_t index) {
+    // Setting LED driver to shutdown mode
+    is31fl3236_write_register(index, IS31FL3236_REG_SHUTDOWN, 0x00);
+}
@@ -62,6 +62,9 @@ void is31fl3236_update_led_control_registers(uint8_t index);
 
 void is31fl3236_flush(void);
 
+void is31fl3236_sw_return_normal(uint8_t index);
+void is31fl3236_sw_shutdown(uint8_t index);
+
 #define IS31FL3236_PWM_FREQUENCY_3K_HZ 0b0
 #define IS31FL3236_PWM_FREQUENCY_22K_HZ 0b1
 
@@ -20,6 +20,7 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "led/led_dirty.h"
 
 #define IS31FL3729_PWM_REGISTER_COUNT 143
 #define IS31FL3729_SCALING_REGISTER_COUNT 16
@@ -81,14 +82,14 @@ const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
 // Storing them like this is optimal for I2C transfers to the registers.
 typedef struct is31fl3729_driver_t {
     uint8_t pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[LED_DIRTY_BITMAP_SIZE(IS31FL3729_PWM_REGISTER_COUNT)];
     uint8_t scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
 } PACKED is31fl3729_driver_t;
 
 is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = {0},
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -104,17 +105,20 @@ void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 }
 
 void is31fl3729_write_pwm_buffer(uint8_t index) {
-    // Transmit PWM registers in 11 transfers of 13 bytes.
+    // Transmit the PWM registers that changed since the last flush, in transfers of up to 13 bytes.
 
-    // Iterate over the pwm_buffer contents at 13 byte intervals.
-    for (uint8_t i = 0; i <= IS31FL3729_PWM_REGISTER_COUNT; i += 13) {
+    uint8_t i = 0;
+    uint8_t length;
+
+    while ((length = led_dirty_next_run(driver_buffers[index].pwm_buffer_dirty, IS31FL3729_PWM_REGISTER_COUNT, &i, 13)) > 0) {
 #if IS31FL3729_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT);
+        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3729_I2C_TIMEOUT);
 #endif
+        i += length;
     }
 }
 
@@ -165,7 +169,7 @@ void is31fl3729_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        led_dirty_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.v);
     }
 }
 
@@ -189,10 +193,8 @@ void is31fl3729_set_scaling_register(uint8_t index, uint8_t value) {
 }
 
 void is31fl3729_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
+    if (led_dirty_any(driver_buffers[index].pwm_buffer_dirty, IS31FL3729_PWM_REGISTER_COUNT)) {
         is31fl3729_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
 
@@ -211,3 +213,13 @@ void is31fl3729_flush(void) {
         is31fl3729_update_pwm_buffers(i);
     }
 }
+
+void is31fl3729_sw_return_normal(uint8_t index) {
+    // Setting LED driver to normal mode
+    is31fl3729_write_register(index, IS31FL3729_REG_CONFIGURATION, IS31FL3729_CONFIGURATION);
+}
+
+void is31fl3729_sw_shutdown(uint8_t index) {
+    // Setting LED driver to shutdown mode
+    is31fl3729_write_register(index, IS31FL3729_REG_CONFIGURATION, IS31FL3729_CONFIGURATION & ~0x01);
+}
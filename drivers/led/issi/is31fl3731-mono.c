@@ -21,6 +21,7 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "led/led_dirty.h"
 
 #define IS31FL3731_PWM_REGISTER_COUNT 144
 #define IS31FL3731_LED_CONTROL_REGISTER_COUNT 18
@@ -53,14 +54,14 @@ const uint8_t i2c_addresses[IS31FL3731_DRIVER_COUNT] = {
 // probably not worth the extra complexity.
 typedef struct is31fl3731_driver_t {
     uint8_t pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[LED_DIRTY_BITMAP_SIZE(IS31FL3731_PWM_REGISTER_COUNT)];
     uint8_t led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED is31fl3731_driver_t;
 
 is31fl3731_driver_t driver_buffers[IS31FL3731_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = {0},
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -81,17 +82,20 @@ void is31fl3731_select_page(uint8_t index, uint8_t page) {
 
 void is31fl3731_write_pwm_buffer(uint8_t index) {
     // Assumes page 0 is already selected.
-    // Transmit PWM registers in 9 transfers of 16 bytes.
+    // Transmit the PWM registers that changed since the last flush, in transfers of up to 16 bytes.
 
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
+    uint8_t i = 0;
+    uint8_t length;
+
+    while ((length = led_dirty_next_run(driver_buffers[index].pwm_buffer_dirty, IS31FL3731_PWM_REGISTER_COUNT, &i, 16)) > 0) {
 #if IS31FL3731_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3731_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT);
+        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3731_I2C_TIMEOUT);
 #endif
+        i += length;
     }
 }
 
@@ -179,7 +183,7 @@ void is31fl3731_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        led_dirty_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.v);
     }
 }
 
@@ -206,10 +210,8 @@ void is31fl3731_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3731_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
+    if (led_dirty_any(driver_buffers[index].pwm_buffer_dirty, IS31FL3731_PWM_REGISTER_COUNT)) {
         is31fl3731_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
 
@@ -228,3 +230,17 @@ void is31fl3731_flush(void) {
         is31fl3731_update_pwm_buffers(i);
     }
 }
+
+void is31fl3731_sw_return_normal(uint8_t index) {
+    is31fl3731_select_page(index, IS31FL3731_COMMAND_FUNCTION);
+
+    // Setting LED driver to normal mode
+    is31fl3731_write_register(index, IS31FL3731_FUNCTION_REG_SHUTDOWN, 0x01);
+}
+
+void is31fl3731_sw_shutdown(uint8_t index) {
+    is31fl3731_select_page(index, IS31FL3731_COMMAND_FUNCTION);
+
+    // Setting LED driver to shutdown mode
+    is31fl3731_write_register(index, IS31FL3731_FUNCTION_REG_SHUTDOWN, 0x00);
+}
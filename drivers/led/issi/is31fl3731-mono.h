@@ -123,6 +123,9 @@ void is31fl3731_update_led_control_registers(uint8_t index);
 
 void is31fl3731_flush(void);
 
+void is31fl3731_sw_return_normal(uint8_t index);
+void is31fl3731_sw_shutdown(uint8_t index);
+
 #define C1_1 0x00
 #define C1_2 0x01
 #define C1_3 0x02
@@ -133,6 +133,9 @@ void is31fl3733_update_led_control_registers(uint8_t index);
 
 void is31fl3733_flush(void);
 
+void is31fl3733_sw_return_normal(uint8_t index);
+void is31fl3733_sw_shutdown(uint8_t index);
+
 #define IS31FL3733_PDR_0_OHM 0b000   // No pull-down resistor
 #define IS31FL3733_PDR_0K5_OHM 0b001 // 0.5 kOhm resistor
 #define IS31FL3733_PDR_1K_OHM 0b010  // 1 kOhm resistor
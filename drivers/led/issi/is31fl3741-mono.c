@@ -21,6 +21,7 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "led/led_dirty.h"
 
 #define IS31FL3741_PWM_0_REGISTER_COUNT 180
 #define IS31FL3741_PWM_1_REGISTER_COUNT 171
@@ -77,7 +78,8 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 typedef struct is31fl3741_driver_t {
     uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
     uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_0_dirty[LED_DIRTY_BITMAP_SIZE(IS31FL3741_PWM_0_REGISTER_COUNT)];
+    uint8_t pwm_buffer_1_dirty[LED_DIRTY_BITMAP_SIZE(IS31FL3741_PWM_1_REGISTER_COUNT)];
     uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
     uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
@@ -86,7 +88,8 @@ typedef struct is31fl3741_driver_t {
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_0_dirty   = {0},
+    .pwm_buffer_1_dirty   = {0},
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
     .scaling_buffer_dirty = false,
@@ -108,34 +111,41 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
 }
 
 void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+    uint8_t i;
+    uint8_t length;
 
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
+    if (led_dirty_any(driver_buffers[index].pwm_buffer_0_dirty, IS31FL3741_PWM_0_REGISTER_COUNT)) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
 
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
+        // Transmit the PWM0 registers that changed since the last flush, in transfers of up to 30 bytes.
+        i = 0;
+        while ((length = led_dirty_next_run(driver_buffers[index].pwm_buffer_0_dirty, IS31FL3741_PWM_0_REGISTER_COUNT, &i, 30)) > 0) {
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+            for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
+                if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
+            i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, length, IS31FL3741_I2C_TIMEOUT);
 #endif
+            i += length;
+        }
     }
 
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
+    if (led_dirty_any(driver_buffers[index].pwm_buffer_1_dirty, IS31FL3741_PWM_1_REGISTER_COUNT)) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
 
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
-
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
+        // Transmit the PWM1 registers that changed since the last flush, in transfers of up to 19 bytes.
+        i = 0;
+        while ((length = led_dirty_next_run(driver_buffers[index].pwm_buffer_1_dirty, IS31FL3741_PWM_1_REGISTER_COUNT, &i, 19)) > 0) {
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+            for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
+                if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
+            i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, length, IS31FL3741_I2C_TIMEOUT);
 #endif
+            i += length;
+        }
     }
 }
 
@@ -196,8 +206,10 @@ uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
 void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
     if (reg & 0x100) {
         driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
+        led_dirty_mark(driver_buffers[driver].pwm_buffer_1_dirty, reg & 0xFF);
     } else {
         driver_buffers[driver].pwm_buffer_0[reg] = value;
+        led_dirty_mark(driver_buffers[driver].pwm_buffer_0_dirty, reg);
     }
 }
 
@@ -212,7 +224,6 @@ void is31fl3741_set_value(int index, uint8_t value) {
         }
 
         set_pwm_value(led.driver, led.v, value);
-        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -240,16 +251,11 @@ void is31fl3741_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3741_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
-    }
+    is31fl3741_write_pwm_buffer(index);
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t value) {
     set_pwm_value(pled->driver, pled->v, value);
-    driver_buffers[pled->driver].pwm_buffer_dirty = true;
 }
 
 void is31fl3741_update_led_control_registers(uint8_t index) {
@@ -280,3 +286,17 @@ void is31fl3741_flush(void) {
         is31fl3741_update_pwm_buffers(i);
     }
 }
+
+void is31fl3741_sw_return_normal(uint8_t index) {
+    is31fl3741_select_page(index, IS31FL3741_COMMAND_FUNCTION);
+
+    // Setting LED driver to normal mode
+    is31fl3741_write_register(index, IS31FL3741_FUNCTION_REG_CONFIGURATION, IS31FL3741_CONFIGURATION);
+}
+
+void is31fl3741_sw_shutdown(uint8_t index) {
+    is31fl3741_select_page(index, IS31FL3741_COMMAND_FUNCTION);
+
+    // Setting LED driver to shutdown mode
+    is31fl3741_write_register(index, IS31FL3741_FUNCTION_REG_CONFIGURATION, IS31FL3741_CONFIGURATION & ~0x01);
+}
@@ -100,6 +100,9 @@ void is31fl3746a_update_scaling_registers(uint8_t index);
 
 void is31fl3746a_flush(void);
 
+void is31fl3746a_sw_return_normal(uint8_t index);
+void is31fl3746a_sw_shutdown(uint8_t index);
+
 #define IS31FL3746A_PDR_0_OHM 0b000          // No pull-down resistor
 #define IS31FL3746A_PDR_0K5_OHM_SW_OFF 0b001 // 0.5 kOhm resistor in SWx off time
 #define IS31FL3746A_PDR_1K_OHM_SW_OFF 0b010  // 1 kOhm resistor in SWx off time
@@ -0,0 +1,80 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Per-register dirty tracking for LED driver buffers.
+ *
+ * A driver keeps one bit per register next to each buffer it mirrors, marks
+ * registers as their value changes, and on flush walks the bitmap with
+ * led_dirty_next_run() to send only the runs of registers that changed.
+ */
+
+// Clean registers that may sit between two dirty ones and still be sent in the
+// same transfer. Starting a new transfer costs at least the device address and
+// register bytes, so resending a couple of unchanged registers is cheaper.
+#ifndef LED_DIRTY_MERGE_GAP
+#    define LED_DIRTY_MERGE_GAP 2
+#endif
+
+#define LED_DIRTY_BITMAP_SIZE(count) (((count) + 7) / 8)
+
+static inline void led_dirty_mark(uint8_t *bitmap, uint8_t reg) {
+    bitmap[reg / 8] |= 1 << (reg % 8);
+}
+
+static inline bool led_dirty_is_marked(const uint8_t *bitmap, uint8_t reg) {
+    return bitmap[reg / 8] & (1 << (reg % 8));
+}
+
+static inline bool led_dirty_any(const uint8_t *bitmap, uint8_t count) {
+    for (uint8_t i = 0; i < LED_DIRTY_BITMAP_SIZE(count); i++) {
+        if (bitmap[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Find and claim the next run of dirty registers.
+ *
+ * Searches from `*start` onwards and moves it to the first register of the
+ * run. The run is at most `max_length` registers long and may include up to
+ * LED_DIRTY_MERGE_GAP clean registers between dirty ones. Its bits are
+ * cleared before returning.
+ *
+ * @return The length of the run, or 0 if nothing at or after `*start` is dirty.
+ */
+static inline uint8_t led_dirty_next_run(uint8_t *bitmap, uint8_t count, uint8_t *start, uint8_t max_length) {
+    uint16_t reg = *start;
+
+    while (reg < count && !led_dirty_is_marked(bitmap, reg)) {
+        // Skip whole clean bytes of the bitmap at a time
+        reg += (reg % 8 == 0 && bitmap[reg / 8] == 0) ? 8 : 1;
+    }
+    if (reg >= count) {
+        return 0;
+    }
+
+    uint16_t end   = reg + 1;
+    uint16_t limit = reg + max_length < count ? reg + max_length : count;
+    for (uint16_t i = end; i < limit; i++) {
+        if (led_dirty_is_marked(bitmap, i)) {
+            end = i + 1;
+        } else if (i - end >= LED_DIRTY_MERGE_GAP) {
+            break;
+        }
+    }
+
+    for (uint16_t i = reg; i < end; i++) {
+        bitmap[i / 8] &= ~(1 << (i % 8));
+    }
+
+    *start = reg;
+    return end - reg;
+}
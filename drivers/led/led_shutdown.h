@@ -0,0 +1,26 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Shutdown hooks shared by the RGB and LED matrix driver tables.
+ *
+ * Chips that support several devices on one bus take a device index in
+ * <chip>_sw_shutdown() and <chip>_sw_return_normal(). This defines
+ * shutdown_drivers() and exit_shutdown_drivers() that apply them to every
+ * configured device, for use as the shutdown and exit_shutdown members.
+ */
+#define LED_SHUTDOWN_DRIVERS(chip, count)                  \
+    static void shutdown_drivers(void) {                   \
+        for (uint8_t i = 0; i < (count); i++) {            \
+            chip##_sw_shutdown(i);                         \
+        }                                                  \
+    }                                                      \
+    static void exit_shutdown_drivers(void) {              \
+        for (uint8_t i = 0; i < (count); i++) {            \
+            chip##_sw_return_normal(i);                    \
+        }                                                  \
+    }
@@ -3,12 +3,24 @@
 
 #ifdef QUANTUM_PAINTER_SPI_ENABLE
 
+#    include <string.h>
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
 
+#    if defined(QUANTUM_PAINTER_SPI_ASYNC) && !defined(PROTOCOL_CHIBIOS)
+#        error "QUANTUM_PAINTER_SPI_ASYNC is only supported on ChibiOS"
+#    endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
 
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC
+// Callers reuse their buffers as soon as the send returns, so each chunk is copied out before it is transmitted. Two
+// buffers let the next chunk be prepared while the previous one is still going out over DMA.
+__attribute__((__aligned__(4))) static uint8_t qp_comms_spi_async_buffer[2][QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE];
+static uint8_t qp_comms_spi_async_next = 0;
+#    endif
+
 bool qp_comms_spi_init(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -33,11 +45,23 @@ bool qp_comms_spi_start(painter_device_t device) {
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
     uint32_t       bytes_remaining = byte_count;
     const uint8_t *p               = (const uint8_t *)data;
-    const uint32_t max_msg_length  = 1024;
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC
+    const uint32_t max_msg_length = QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE;
+#    else
+    const uint32_t max_msg_length = 1024;
+#    endif
 
     while (bytes_remaining > 0) {
         uint32_t bytes_this_loop = QP_MIN(bytes_remaining, max_msg_length);
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC
+        // The buffer being filled is not the one in flight, which is waited on before this one starts
+        uint8_t *buffer = qp_comms_spi_async_buffer[qp_comms_spi_async_next];
+        qp_comms_spi_async_next ^= 1;
+        memcpy(buffer, p, bytes_this_loop);
+        spi_transmit_async(buffer, bytes_this_loop);
+#    else
         spi_transmit(p, bytes_this_loop);
+#    endif
         p += bytes_this_loop;
         bytes_remaining -= bytes_this_loop;
     }
@@ -48,7 +72,7 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
 void qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
-    spi_stop();
+    spi_stop(); // also waits for any data still being sent
     gpio_write_pin_high(comms_config->chip_select_pin);
 }
 
@@ -100,6 +124,10 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+#        ifdef QUANTUM_PAINTER_SPI_ASYNC
+    // Data may still be going out, which must finish before D/C is switched to command
+    spi_wait();
+#        endif
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
 }
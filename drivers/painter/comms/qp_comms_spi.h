@@ -12,6 +12,11 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
 
+#    ifndef QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE
+// Size of each of the two buffers used to send data in the background with QUANTUM_PAINTER_SPI_ASYNC
+#        define QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE 1024
+#    endif
+
 typedef struct qp_comms_spi_config_t {
     pin_t    chip_select_pin;
     uint16_t divisor;
@@ -21,6 +21,23 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_NUM_DIRTY_REGIONS
+/**
+ * @def This controls the maximum number of separate dirty regions each surface keeps track of.
+ *      Widgets drawn far apart from each other are then transferred as separate regions, instead of as one region
+ *      covering everything in between. Each region requires 8 bytes of RAM per surface.
+ */
+#    define SURFACE_NUM_DIRTY_REGIONS 4
+#endif
+
+#ifndef SURFACE_DIRTY_REGION_OVERHEAD
+/**
+ * @def The cost of transferring an extra region, in pixels. Regions are extended or merged whenever that adds fewer
+ *      pixels than this, as setting up the transfer of another region costs about as much as sending this many pixels.
+ */
+#    define SURFACE_DIRTY_REGION_OVERHEAD 64
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -53,13 +70,13 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
 /**
  * Helper method to draw the contents of the framebuffer to the target device.
  *
- * After successful completion, the dirty area is reset.
+ * After successful completion, the dirty regions are reset.
  *
  * @param surface[in] the surface to copy from
  * @param target[in] the target device to copy into
  * @param x[in] the x-location of the original position of the framebuffer
  * @param y[in] the y-location of the original position of the framebuffer
- * @param entire_surface[in] whether the entire surface should be drawn, instead of just the dirty region
+ * @param entire_surface[in] whether the entire surface should be drawn, instead of just the dirty regions
  * @return whether the draw operation completed successfully
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
@@ -29,24 +29,86 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
-void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
-    // Maintain dirty region
-    if (dirty->l > x) {
-        dirty->l        = x;
-        dirty->is_dirty = true;
+static inline bool dirty_rect_contains(const surface_dirty_rect_t *rect, uint16_t x, uint16_t y) {
+    return x >= rect->l && x <= rect->r && y >= rect->t && y <= rect->b;
+}
+
+static inline bool dirty_rect_overlaps(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return a->l <= b->r && b->l <= a->r && a->t <= b->b && b->t <= a->b;
+}
+
+static inline uint32_t dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (rect->b - rect->t + 1);
+}
+
+static inline surface_dirty_rect_t dirty_rect_union(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return (surface_dirty_rect_t){
+        .l = QP_MIN(a->l, b->l),
+        .t = QP_MIN(a->t, b->t),
+        .r = QP_MAX(a->r, b->r),
+        .b = QP_MAX(a->b, b->b),
+    };
+}
+
+// Merges the given region with any others it overlaps, or that are cheaper to transfer together with it
+static void qp_surface_merge_dirty(surface_dirty_data_t *dirty, uint8_t index) {
+    uint8_t i = 0;
+    while (i < dirty->num_regions) {
+        surface_dirty_rect_t *a = &dirty->regions[index];
+        surface_dirty_rect_t *b = &dirty->regions[i];
+        if (i != index) {
+            surface_dirty_rect_t merged = dirty_rect_union(a, b);
+            if (dirty_rect_overlaps(a, b) || dirty_rect_area(&merged) <= dirty_rect_area(a) + dirty_rect_area(b) + SURFACE_DIRTY_REGION_OVERHEAD) {
+                *a = merged;
+
+                // Drop the absorbed region, then start over as the merged one may now reach others
+                dirty->regions[i] = dirty->regions[--dirty->num_regions];
+                if (index == dirty->num_regions) {
+                    index = i;
+                }
+                i = 0;
+                continue;
+            }
+        }
+        ++i;
     }
-    if (dirty->r < x) {
-        dirty->r        = x;
-        dirty->is_dirty = true;
+    dirty->last_region = index;
+}
+
+void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    // Consecutive pixels usually land in the same region
+    if (dirty->num_regions > 0 && dirty_rect_contains(&dirty->regions[dirty->last_region], x, y)) {
+        return;
     }
-    if (dirty->t > y) {
-        dirty->t        = y;
-        dirty->is_dirty = true;
+
+    // Find the region that needs to grow the least to include this pixel
+    surface_dirty_rect_t pixel       = {.l = x, .t = y, .r = x, .b = y};
+    uint8_t              best        = 0;
+    uint32_t             best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->num_regions; ++i) {
+        surface_dirty_rect_t grown  = dirty_rect_union(&dirty->regions[i], &pixel);
+        uint32_t             growth = dirty_rect_area(&grown) - dirty_rect_area(&dirty->regions[i]);
+        if (growth == 0) {
+            dirty->last_region = i;
+            return;
+        }
+        if (growth < best_growth) {
+            best        = i;
+            best_growth = growth;
+        }
     }
-    if (dirty->b < y) {
-        dirty->b        = y;
-        dirty->is_dirty = true;
+
+    dirty->is_dirty = true;
+
+    // Start a new region if that's cheaper than growing an existing one
+    if (dirty->num_regions < SURFACE_NUM_DIRTY_REGIONS && best_growth > SURFACE_DIRTY_REGION_OVERHEAD) {
+        dirty->last_region                   = dirty->num_regions;
+        dirty->regions[dirty->num_regions++] = pixel;
+        return;
     }
+
+    dirty->regions[best] = dirty_rect_union(&dirty->regions[best], &pixel);
+    qp_surface_merge_dirty(dirty, best);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +119,13 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    surface->dirty.regions[0].l = 0;
+    surface->dirty.regions[0].t = 0;
+    surface->dirty.regions[0].r = surface->base.panel_width - 1;
+    surface->dirty.regions[0].b = surface->base.panel_height - 1;
+    surface->dirty.num_regions  = 1;
+    surface->dirty.last_region  = 0;
+    surface->dirty.is_dirty     = true;
 
     return true;
 }
@@ -80,9 +144,9 @@ bool qp_surface_clear(painter_device_t device) {
 bool qp_surface_flush(painter_device_t device) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    surface->dirty.l = surface->dirty.t = UINT16_MAX;
-    surface->dirty.r = surface->dirty.b = 0;
-    surface->dirty.is_dirty             = false;
+    surface->dirty.num_regions = 0;
+    surface->dirty.last_region = 0;
+    surface->dirty.is_dirty    = false;
     return true;
 }
 
@@ -103,7 +167,7 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Drawing routine to copy out the dirty region and send it to another device
+// Drawing routine to copy out the dirty regions and send them to another device
 
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
     painter_driver_t *        surface_driver = (painter_driver_t *)surface;
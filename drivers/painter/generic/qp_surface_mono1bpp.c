@@ -61,6 +61,17 @@ static bool qp_surface_pixdata_mono1bpp(painter_device_t device, const void *pix
     return true;
 }
 
+// Stream the same pixel repeatedly to the current write position in GRAM
+static bool qp_surface_pixfill_mono1bpp(painter_device_t device, const void *native_pixel, uint32_t native_pixel_count) {
+    painter_driver_t *        driver     = (painter_driver_t *)device;
+    surface_painter_device_t *surface    = (surface_painter_device_t *)driver;
+    bool                      mono_pixel = (*(const uint8_t *)native_pixel & 1) ? true : false;
+    for (uint32_t pixel_counter = 0; pixel_counter < native_pixel_count; ++pixel_counter) {
+        append_pixel_mono1bpp(surface, mono_pixel);
+    }
+    return true;
+}
+
 // Pixel colour conversion
 static bool qp_surface_palette_convert_mono1bpp(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
     for (int16_t i = 0; i < palette_size; ++i) {
@@ -104,6 +115,7 @@ const surface_painter_driver_vtable_t mono1bpp_surface_driver_vtable = {
             .palette_convert = qp_surface_palette_convert_mono1bpp,
             .append_pixels   = qp_surface_append_pixels_mono1bpp,
             .append_pixdata  = qp_surface_append_pixdata_mono1bpp,
+            .pixfill         = qp_surface_pixfill_mono1bpp,
         },
     .target_pixdata_transfer = mono1bpp_target_pixdata_transfer,
 };
@@ -49,6 +49,17 @@ static bool qp_surface_pixdata_rgb565(painter_device_t device, const void *pixel
     return true;
 }
 
+// Stream the same pixel repeatedly to the current write position in GRAM
+static bool qp_surface_pixfill_rgb565(painter_device_t device, const void *native_pixel, uint32_t native_pixel_count) {
+    painter_driver_t *        driver  = (painter_driver_t *)device;
+    surface_painter_device_t *surface = (surface_painter_device_t *)driver;
+    uint16_t                  rgb565  = *(const uint16_t *)native_pixel;
+    for (uint32_t pixel_counter = 0; pixel_counter < native_pixel_count; ++pixel_counter) {
+        append_pixel_rgb565(surface, rgb565);
+    }
+    return true;
+}
+
 // Pixel colour conversion
 static bool qp_surface_palette_convert_rgb565_swapped(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
     for (int16_t i = 0; i < palette_size; ++i) {
@@ -61,25 +72,21 @@ static bool qp_surface_palette_convert_rgb565_swapped(painter_device_t device, i
 
 // Append pixels to the target location, keyed by the pixel index
 static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
-    uint16_t *buf = (uint16_t *)target_buffer;
-    for (uint32_t i = 0; i < pixel_count; ++i) {
-        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
-    }
-    return true;
+    return qp_internal_append_pixels_rgb565(target_buffer, palette, pixel_offset, pixel_count, palette_indices);
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb565_target_pixdata_transfer_region(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, const surface_dirty_rect_t *region) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+    uint16_t l = region->l;
+    uint16_t t = region->t;
+    uint16_t r = region->r;
+    uint16_t b = region->b;
 
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
-        qp_dprintf("rgb565_target_pixdata_transfer: fail (could not set target viewport)\n");
+        qp_dprintf("rgb565_target_pixdata_transfer_region: fail (could not set target viewport)\n");
         return false;
     }
 
@@ -98,7 +105,7 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
             if (pixel_counter == total_pixel_count) {
                 ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
                 if (!ok) {
-                    qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+                    qp_dprintf("rgb565_target_pixdata_transfer_region: fail (could not stream pixdata to target)\n");
                     return false;
                 }
                 // Reset the counter
@@ -111,7 +118,25 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     if (pixel_counter > 0) {
         ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
         if (!ok) {
-            qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+            qp_dprintf("rgb565_target_pixdata_transfer_region: fail (could not stream pixdata to target)\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        surface_dirty_rect_t everything = {.l = 0, .t = 0, .r = surface_handle->base.panel_width - 1, .b = surface_handle->base.panel_height - 1};
+        return rgb565_target_pixdata_transfer_region(surface_driver, target_driver, x, y, &everything);
+    }
+
+    // Each dirty region is sent separately, so the pixels between them are left alone
+    for (uint8_t i = 0; i < surface_handle->dirty.num_regions; ++i) {
+        if (!rgb565_target_pixdata_transfer_region(surface_driver, target_driver, x, y, &surface_handle->dirty.regions[i])) {
             return false;
         }
     }
@@ -136,6 +161,7 @@ const surface_painter_driver_vtable_t rgb565_surface_driver_vtable = {
             .palette_convert = qp_surface_palette_convert_rgb565_swapped,
             .append_pixels   = qp_surface_append_pixels_rgb565,
             .append_pixdata  = qp_surface_append_pixdata_rgb565,
+            .pixfill         = qp_surface_pixfill_rgb565,
         },
     .target_pixdata_transfer = rgb565_target_pixdata_transfer,
 };
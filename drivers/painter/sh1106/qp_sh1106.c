@@ -83,20 +83,23 @@ bool qp_sh1106_flush(painter_device_t device) {
         return true;
     }
 
-    switch (driver->oled.base.rotation) {
-        default:
-        case QP_ROTATION_0:
-            qp_oled_panel_page_column_flush_rot0(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_90:
-            qp_oled_panel_page_column_flush_rot90(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_180:
-            qp_oled_panel_page_column_flush_rot180(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_270:
-            qp_oled_panel_page_column_flush_rot270(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
+    for (uint8_t i = 0; i < driver->oled.surface.dirty.num_regions; ++i) {
+        const surface_dirty_rect_t *region = &driver->oled.surface.dirty.regions[i];
+        switch (driver->oled.base.rotation) {
+            default:
+            case QP_ROTATION_0:
+                qp_oled_panel_page_column_flush_rot0(device, region, driver->framebuffer);
+                break;
+            case QP_ROTATION_90:
+                qp_oled_panel_page_column_flush_rot90(device, region, driver->framebuffer);
+                break;
+            case QP_ROTATION_180:
+                qp_oled_panel_page_column_flush_rot180(device, region, driver->framebuffer);
+                break;
+            case QP_ROTATION_270:
+                qp_oled_panel_page_column_flush_rot270(device, region, driver->framebuffer);
+                break;
+        }
     }
 
     // Clear the dirty area
@@ -111,11 +111,7 @@ bool qp_tft_panel_palette_convert_rgb888(painter_device_t device, int16_t palett
 // Append pixels to the target location, keyed by the pixel index
 
 bool qp_tft_panel_append_pixels_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
-    uint16_t *buf = (uint16_t *)target_buffer;
-    for (uint32_t i = 0; i < pixel_count; ++i) {
-        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
-    }
-    return true;
+    return qp_internal_append_pixels_rgb565(target_buffer, palette, pixel_offset, pixel_count, palette_indices);
 }
 
 bool qp_tft_panel_append_pixels_rgb888(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
@@ -27,6 +27,8 @@ void soft_serial_initiator_init(void);
 void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
+// same as soft_serial_transaction, but gives up if the target doesn't answer the handshake within timeout_ms
+bool soft_serial_probe(int sstd_index, uint16_t timeout_ms);
 
 #ifdef SERIAL_DEBUG
 #    include <debug.h>
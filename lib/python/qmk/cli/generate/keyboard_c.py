@@ -9,6 +9,113 @@ from qmk.path import normpath
 from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
 
 
+def _sqrt16(x):
+    """Port of lib8tion's sqrt16(), including its truncation of the input to 16 bits.
+    """
+    x &= 0xFFFF
+    if x <= 1:
+        return x
+
+    low = 1
+    hi = 255 if x > 7904 else (x >> 5) + 8
+    while hi >= low:
+        mid = (low + hi) >> 1
+        if (mid * mid) & 0xFFFF > x:
+            hi = mid - 1
+        else:
+            if mid == 255:
+                return 255
+            low = mid + 1
+
+    return low - 1
+
+
+def _c_div(a, b):
+    """Integer division rounding towards zero, as C does.
+    """
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def _atan2_8(dy, dx):
+    """Port of lib8tion's atan2_8().
+    """
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = 32 - _c_div(32 * (dx - abs_y), dx + abs_y)
+    else:
+        a = 96 - _c_div(32 * (dx + abs_y), abs_y - dx)
+
+    return (-a if dy < 0 else a) & 0xFF
+
+
+def _gen_led_geometry(info_data, config_type):
+    """Precompute each LED's offset, distance and angle from the centre point for the effect runners
+    """
+    center_x, center_y = info_data[config_type].get('center_point', [112, 32])
+
+    geometry = []
+    for led_data in info_data[config_type]['layout']:
+        dx = led_data.get('x', 0) - center_x
+        dy = led_data.get('y', 0) - center_y
+        geometry.append(f'{{{dx}, {dy}, {_sqrt16(dx * dx + dy * dy)}, {_atan2_8(dy, dx)}}}')
+
+    lines = []
+    lines.append('#if RGB_MATRIX_GEOMETRY_TABLE')
+    lines.append('__attribute__ ((weak)) const led_geometry_t g_rgb_matrix_geometry[RGB_MATRIX_LED_COUNT] PROGMEM = {')
+    for entry in geometry:
+        lines.append(f'  {entry},')
+    lines.append('};')
+    lines.append('#endif')
+
+    return lines
+
+
+def _gen_heatmap_neighbours(info_data, config_type, radius=40):
+    """Build the per-key neighbour lists used by the typing heatmap, covering every key within `radius`
+    """
+    key_leds = {}
+    for index, led_data in enumerate(info_data[config_type]['layout']):
+        if 'matrix' in led_data:
+            key_leds[tuple(led_data['matrix'])] = index
+
+    points = [(led_data.get('x', 0), led_data.get('y', 0)) for led_data in info_data[config_type]['layout']]
+    keys = sorted(key_leds.items())
+    sources = set(key_leds.values())
+
+    index = [0]
+    neighbours = []
+    for led in range(len(points)):
+        if led in sources:
+            for (row, col), other in keys:
+                if other == led:
+                    continue
+                dx = points[led][0] - points[other][0]
+                dy = points[led][1] - points[other][1]
+                dist = _sqrt16(dx * dx + dy * dy)
+                if dist <= radius:
+                    neighbours.append(f'{{{row}, {col}, {dist}}}')
+        index.append(len(neighbours))
+
+    if not neighbours:
+        return []
+
+    lines = []
+    lines.append('#if RGB_MATRIX_GEOMETRY_TABLE && defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP) && !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM)')
+    lines.append(f'__attribute__ ((weak)) const uint8_t g_rgb_matrix_heatmap_radius = {radius};')
+    lines.append(f'__attribute__ ((weak)) const uint16_t g_rgb_matrix_heatmap_index[RGB_MATRIX_LED_COUNT + 1] PROGMEM = {{ {", ".join(map(str, index))} }};')
+    lines.append('__attribute__ ((weak)) const led_neighbour_t g_rgb_matrix_heatmap_neighbours[] PROGMEM = {')
+    for i in range(0, len(neighbours), 8):
+        lines.append(f'  {", ".join(neighbours[i:i + 8])},')
+    lines.append('};')
+    lines.append('#endif')
+
+    return lines
+
+
 def _gen_led_configs(info_data):
     lines = []
 
@@ -56,6 +163,9 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+    if config_type == 'rgb_matrix':
+        lines.extend(_gen_led_geometry(info_data, config_type))
+        lines.extend(_gen_heatmap_neighbours(info_data, config_type))
     lines.append('#endif')
     lines.append('')
 
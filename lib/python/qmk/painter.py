@@ -430,3 +430,90 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def compress_bytes_qmk_lz(bytearray):
+    """Compresses data using the QMK LZ scheme, see docs/quantum_painter_lz.md.
+
+    Each token is either a literal run of up to 128 octets, or a copy of at least 3 octets from up to 1024 octets back in
+    the already decoded output. Matches are found greedily, checking the most recent positions with the same first 3
+    octets.
+    """
+    window_size = 1024
+    min_match = 3
+    max_match = 0xFFFF
+    max_candidates = 64
+
+    data = bytes(bytearray)
+    output = []
+    literals = []
+    chains = {}
+
+    def flush_literals():
+        for n in range(0, len(literals), 128):
+            chunk = literals[n:n + 128]
+            output.append(len(chunk) - 1)
+            output.extend(chunk)
+        literals.clear()
+
+    def remember(pos):
+        if pos + min_match <= len(data):
+            chains.setdefault(data[pos:pos + min_match], []).append(pos)
+
+    pos = 0
+    while pos < len(data):
+        best_length = 0
+        best_distance = 0
+        limit = min(max_match, len(data) - pos)
+        if limit >= min_match:
+            for candidate in reversed(chains.get(data[pos:pos + min_match], [])[-max_candidates:]):
+                distance = pos - candidate
+                if distance > window_size:
+                    break
+                length = min_match
+                while length < limit and data[candidate + length] == data[pos + length]:
+                    length += 1
+                if length > best_length:
+                    best_length = length
+                    best_distance = distance
+                    if length == limit:
+                        break
+
+        if best_length < min_match:
+            literals.append(data[pos])
+            remember(pos)
+            pos += 1
+            continue
+
+        flush_literals()
+        length_field = min(best_length - min_match, 31)
+        output.append(0x80 | (length_field << 2) | ((best_distance - 1) >> 8))
+        output.append((best_distance - 1) & 0xFF)
+        if length_field == 31:
+            extra = best_length - min_match - 31
+            while extra >= 255:
+                output.append(255)
+                extra -= 255
+            output.append(extra)
+
+        for n in range(pos, pos + best_length):
+            remember(n)
+        pos += best_length
+
+    flush_literals()
+    return output
+
+
+def compress_bytes_qmk(bytearray, use_rle, use_lz=False):
+    """Returns the smallest encoding of the supplied data as (compression, data), where compression matches painter_compression_t.
+    """
+    best = (0x00, bytearray)
+    if use_rle:
+        rle_data = compress_bytes_qmk_rle(bytearray)
+        if len(rle_data) < len(best[1]):
+            best = (0x01, rle_data)
+    if use_lz:
+        lz_data = compress_bytes_qmk_lz(bytearray)
+        if len(lz_data) < len(best[1]):
+            best = (0x02, lz_data)
+    return best
@@ -0,0 +1,160 @@
+"""Checks the QMK LZ encoder against the test vectors decoded by quantum/painter/tests.
+
+The C test draws each vector through the Quantum Painter LZ decoder and expects the original data back, so the
+vectors are generated here from compress_bytes_qmk_lz(). To regenerate them after changing the encoder, run:
+
+    python3 lib/python/qmk/tests/test_qmk_painter.py
+"""
+import random
+import sys
+from pathlib import Path
+
+VECTORS_FILE = Path(__file__).resolve().parents[4] / 'quantum' / 'painter' / 'tests' / 'qp_lz_vectors.c'
+
+# The C test draws each vector as an RGB565 image this many pixels wide
+ROW_BYTES = 240 * 2
+
+
+def _random_bytes(rng, count):
+    return bytes(rng.randrange(256) for _ in range(count))
+
+
+def lz_vectors():
+    """Returns (name, data, decoded_length) for each vector. Only the first decoded_length octets are drawn.
+    """
+    rng = random.Random(0x514D4B)
+    vectors = []
+
+    # Matches longer than 34 octets, at distance 1 and further back, carry extension octets
+    prefix = _random_bytes(rng, 18)
+    pattern = _random_bytes(rng, 6)
+    data = prefix + bytes([0x5A]) * 700 + pattern * 40 + bytes([0x00]) * 300
+    data += _random_bytes(rng, 3 * ROW_BYTES - len(data))
+    vectors.append(('long_matches', data, len(data)))
+
+    # Incompressible data is sent as 128-octet literal runs, and is then repeated from exactly 1024 octets back
+    window = _random_bytes(rng, 1024)
+    data = window + window[:3 * ROW_BYTES - 1024]
+    vectors.append(('window_distance', data, len(data)))
+
+    # The image ends part of the way through the last match, both for a repeated octet and for a repeated pattern
+    data = _random_bytes(rng, 20) + bytes([0xA5]) * 1500
+    vectors.append(('ends_in_run', data, 2 * ROW_BYTES))
+    pattern = _random_bytes(rng, 100)
+    data = pattern * 12
+    vectors.append(('ends_in_match', data, 2 * ROW_BYTES))
+
+    return vectors
+
+
+def lz_tokens(encoded):
+    """Splits an encoded stream into ('literal', length) and ('match', distance, length, extension_octets) tokens.
+    """
+    tokens = []
+    pos = 0
+    while pos < len(encoded):
+        marker = encoded[pos]
+        if marker < 0x80:
+            tokens.append(('literal', marker + 1))
+            pos += marker + 2
+            continue
+
+        distance = ((marker & 3) << 8) + encoded[pos + 1] + 1
+        length = ((marker >> 2) & 31) + 3
+        pos += 2
+        extension = 0
+        if length == 34:
+            while True:
+                length += encoded[pos]
+                extension += 1
+                pos += 1
+                if encoded[pos - 1] != 255:
+                    break
+        tokens.append(('match', distance, length, extension))
+    return tokens
+
+
+def lz_decode(encoded):
+    output = bytearray()
+    pos = 0
+    for token in lz_tokens(encoded):
+        if token[0] == 'literal':
+            output += bytes(encoded[pos + 1:pos + 1 + token[1]])
+            pos += token[1] + 1
+        else:
+            _, distance, length, extension = token
+            for _ in range(length):
+                output.append(output[-distance])
+            pos += 2 + extension
+    return bytes(output)
+
+
+def _c_array(name, data):
+    lines = [f'static const uint8_t {name}[] = {{']
+    for n in range(0, len(data), 16):
+        lines.append('    ' + ', '.join(f'0x{b:02X}' for b in data[n:n + 16]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def render_vectors_c():
+    from qmk.painter import compress_bytes_qmk_lz
+
+    arrays = []
+    entries = []
+    for name, data, decoded_length in lz_vectors():
+        arrays.append(_c_array(f'{name}_data', data))
+        arrays.append(_c_array(f'{name}_lz', compress_bytes_qmk_lz(data)))
+        entries.append(f'    {{"{name}", {name}_data, {decoded_length}, {name}_lz, sizeof({name}_lz)}},')
+
+    return '\n'.join([
+        '// Copyright 2024 QMK',
+        '// SPDX-License-Identifier: GPL-2.0-or-later',
+        '',
+        '// Generated by lib/python/qmk/tests/test_qmk_painter.py -- do not edit',
+        '',
+        '#include "qp_lz_vectors.h"',
+        '',
+        '\n\n'.join(arrays),
+        '',
+        'const qp_lz_vector_t qp_lz_vectors[] = {',
+        *entries,
+        '};',
+        '',
+        'const uint8_t qp_lz_vector_count = sizeof(qp_lz_vectors) / sizeof(qp_lz_vectors[0]);',
+        '',
+    ])
+
+
+def test_lz_round_trip():
+    from qmk.painter import compress_bytes_qmk_lz
+
+    for name, data, _ in lz_vectors():
+        assert lz_decode(compress_bytes_qmk_lz(data)) == data, name
+
+
+def test_lz_vectors_cover_format():
+    from qmk.painter import compress_bytes_qmk_lz
+
+    tokens = {name: lz_tokens(compress_bytes_qmk_lz(data)) for name, data, _ in lz_vectors()}
+    matches = [token for stream in tokens.values() for token in stream if token[0] == 'match']
+
+    assert any(length > 34 + 255 and extension > 1 for _, _, length, extension in matches)
+    assert any(distance == 1 and length > 34 for _, distance, length, _ in matches)
+    assert any(distance == 1024 and length > 34 for _, distance, length, _ in matches)
+    assert tokens['window_distance'][:8] == [('literal', 128)] * 8
+
+    # The decoded length cuts the last match short
+    for name, data, decoded_length in lz_vectors():
+        if name.startswith('ends_in'):
+            assert tokens[name][-1][0] == 'match'
+            assert len(data) - tokens[name][-1][2] < decoded_length < len(data)
+
+
+def test_lz_vectors_up_to_date():
+    assert VECTORS_FILE.read_text() == render_vectors_c()
+
+
+if __name__ == '__main__':
+    sys.path.insert(0, str(Path(__file__).resolve().parents[2]))
+    VECTORS_FILE.write_text(render_vectors_c())
@@ -498,6 +498,11 @@ bool soft_serial_transaction(int sstd_index) {
     sei();
     return true;
 }
+
+// The handshake already gives up within microseconds when the target is absent
+bool soft_serial_probe(int sstd_index, uint16_t timeout_ms) {
+    return soft_serial_transaction(sstd_index);
+}
 #else
 #    ifndef USE_I2C
 #        error SOFT_SERIAL_PIN or USE_I2C is required but has not been defined.
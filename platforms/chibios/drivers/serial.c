@@ -295,3 +295,8 @@ static inline bool initiate_transaction(uint8_t sstd_index) {
 bool soft_serial_transaction(int sstd_index) {
     return initiate_transaction((uint8_t)sstd_index);
 }
+
+// The bitbang handshake already gives up within microseconds when the target is absent
+bool soft_serial_probe(int sstd_index, uint16_t timeout_ms) {
+    return soft_serial_transaction(sstd_index);
+}
@@ -4,10 +4,11 @@
 #include <ch.h>
 
 #include "serial.h"
+#include "serial_usart.h"
 #include "serial_protocol.h"
 #include "synchronization_util.h"
 
-static inline bool initiate_transaction(uint8_t transaction_id);
+static inline bool initiate_transaction(uint8_t transaction_id, uint16_t handshake_timeout_ms);
 static inline bool react_to_transaction(void);
 
 /**
@@ -104,13 +105,27 @@ bool soft_serial_transaction(int index) {
      * Parts of failed transactions or spurious bytes could still be in it. */
     serial_transport_driver_clear();
 
-    return initiate_transaction((uint8_t)index);
+    return initiate_transaction((uint8_t)index, SERIAL_USART_TIMEOUT);
+}
+
+/**
+ * @brief Start a transaction like soft_serial_transaction(), but only wait
+ * timeout_ms for the slave to answer the handshake.
+ *
+ * @param index Transaction Table index of the transaction to start.
+ * @param timeout_ms Time to wait for the handshake.
+ * @return bool Indicates success of transaction.
+ */
+bool soft_serial_probe(int index, uint16_t timeout_ms) {
+    serial_transport_driver_clear();
+
+    return initiate_transaction((uint8_t)index, timeout_ms);
 }
 
 /**
  * @brief Initiate transaction to slave half.
  */
-static inline bool initiate_transaction(uint8_t transaction_id) {
+static inline bool initiate_transaction(uint8_t transaction_id, uint16_t handshake_timeout_ms) {
     /* Sanity check that we are actually starting a valid transaction. */
     if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
         serial_dprintf("SPLIT: illegal transaction id\n");
@@ -133,7 +148,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
      *   - due to the half duplex limitations on return codes, we always have to read *something*.
      *   - without the read, write only transactions *always* succeed, even during the boot process where the slave is not ready.
      */
-    if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+    if (unlikely(!serial_transport_receive_timeout(&transaction_id_shake, sizeof(transaction_id_shake), handshake_timeout_ms) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
         serial_dprintf("SPLIT: receiving handshake failed\n");
         return false;
     }
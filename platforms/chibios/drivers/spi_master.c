@@ -26,6 +26,17 @@ static pin_t currentSlavePin;
 
 static SPIConfig spiConfig;
 
+// Taken while a transfer started by spi_transmit_async() is in flight, given back by the end-of-transfer callback
+static BSEMAPHORE_DECL(spiTransferDone, true);
+static bool spiTransferPending = false;
+
+static void spi_transfer_done(SPIDriver *spip) {
+    (void)spip;
+    chSysLockFromISR();
+    chBSemSignalI(&spiTransferDone);
+    chSysUnlockFromISR();
+}
+
 __attribute__((weak)) void spi_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -280,6 +291,12 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 #    error "Unsupported SPI_SELECT_MODE"
 #endif
 
+#ifdef HAL_LLD_SELECT_SPI_V2
+    spiConfig.data_cb = spi_transfer_done;
+#else
+    spiConfig.end_cb = spi_transfer_done;
+#endif
+
     spiStart(&SPI_DRIVER, &spiConfig);
     spiSelect(&SPI_DRIVER);
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
@@ -293,6 +310,7 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 
 spi_status_t spi_write(uint8_t data) {
     uint8_t rxData;
+    spi_wait();
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
     return rxData;
@@ -300,23 +318,43 @@ spi_status_t spi_write(uint8_t data) {
 
 spi_status_t spi_read(void) {
     uint8_t data = 0;
+    spi_wait();
     spiReceive(&SPI_DRIVER, 1, &data);
 
     return data;
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_wait();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_wait();
+    // The callback also fires for blocking transfers, so drop any stale signal before starting
+    chBSemReset(&spiTransferDone, true);
+    spiTransferPending = true;
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_wait(void) {
+    if (spiTransferPending) {
+        chBSemWait(&spiTransferDone);
+        spiTransferPending = false;
+    }
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_wait();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (spiStarted) {
+        spi_wait();
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
         if (currentSlavePin != NO_PIN) {
             gpio_write_pin_high(currentSlavePin);
@@ -85,6 +85,11 @@ spi_status_t spi_read(void);
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+// Starts sending in the background; `data` must stay valid and unchanged until spi_wait() returns
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+void spi_wait(void);
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
 void spi_stop(void);
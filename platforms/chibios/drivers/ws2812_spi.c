@@ -86,54 +86,80 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
+
+// With two buffers, the next frame is encoded into one while the previous one is still being sent from the other.
+// Only applies to async sends, as a circular buffer is always being sent and a sync send has finished on return.
+#if defined(WS2812_SPI_DOUBLE_BUFFER) && !defined(WS2812_SPI_USE_CIRCULAR_BUFFER) && !defined(WS2812_SPI_SYNC)
+#    define TXBUF_COUNT 2
+#else
+#    define TXBUF_COUNT 1
+#endif
+
+static uint8_t txbuf[TXBUF_COUNT][TXBUF_SIZE] = {0};
+#if TXBUF_COUNT > 1
+static uint8_t txbuf_next = 0;
+
+// Given back by the end-of-transfer callback once the previous frame has been clocked out
+static BSEMAPHORE_DECL(txbuf_sent, false);
+
+static void ws2812_spi_send_done(SPIDriver* spip) {
+    (void)spip;
+    chSysLockFromISR();
+    chBSemSignalI(&txbuf_sent);
+    chSysUnlockFromISR();
+}
+#    define WS2812_SPI_END_CB ws2812_spi_send_done
+#else
+#    define txbuf_next 0
+#    define WS2812_SPI_END_CB NULL
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
+ * the ws2812b protocol, each bit of a colour becomes a 4 bit SPI symbol:
+ * 0b1000 for a 0 and 0b1110 for a 1. This table holds the two SPI bytes for
+ * every nibble, most significant bit first.
  */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
+#define WS2812_SPI_SYMBOL(bit) ((bit) ? 0b1110 : 0b1000)
+#define WS2812_SPI_NIBBLE(n) {WS2812_SPI_SYMBOL((n) & 8) << 4 | WS2812_SPI_SYMBOL((n) & 4), WS2812_SPI_SYMBOL((n) & 2) << 4 | WS2812_SPI_SYMBOL((n) & 1)}
+
+static const uint8_t protocol_eq[16][2] = {
+    WS2812_SPI_NIBBLE(0),  WS2812_SPI_NIBBLE(1),  WS2812_SPI_NIBBLE(2),  WS2812_SPI_NIBBLE(3),
+    WS2812_SPI_NIBBLE(4),  WS2812_SPI_NIBBLE(5),  WS2812_SPI_NIBBLE(6),  WS2812_SPI_NIBBLE(7),
+    WS2812_SPI_NIBBLE(8),  WS2812_SPI_NIBBLE(9),  WS2812_SPI_NIBBLE(10), WS2812_SPI_NIBBLE(11),
+    WS2812_SPI_NIBBLE(12), WS2812_SPI_NIBBLE(13), WS2812_SPI_NIBBLE(14), WS2812_SPI_NIBBLE(15),
+};
+
+static inline uint8_t* set_led_byte(uint8_t* tx, uint8_t data) {
+    const uint8_t* high = protocol_eq[data >> 4];
+    const uint8_t* low  = protocol_eq[data & 0x0F];
+
+    tx[0] = high[0];
+    tx[1] = high[1];
+    tx[2] = low[0];
+    tx[3] = low[1];
+    return tx + BYTES_FOR_LED_BYTE;
 }
 
-static void set_led_color_rgb(rgb_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static void set_led_color_rgb(uint8_t* tx_start, rgb_led_t color, int pos) {
+    uint8_t* tx = &tx_start[PREAMBLE_SIZE + BYTES_FOR_LED * pos];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    tx = set_led_byte(tx, color.g);
+    tx = set_led_byte(tx, color.r);
+    tx = set_led_byte(tx, color.b);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    tx = set_led_byte(tx, color.r);
+    tx = set_led_byte(tx, color.g);
+    tx = set_led_byte(tx, color.b);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
+    tx = set_led_byte(tx, color.b);
+    tx = set_led_byte(tx, color.g);
+    tx = set_led_byte(tx, color.r);
 #endif
 #ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 4 + j] = get_protocol_eq(color.w, j);
+    tx = set_led_byte(tx, color.w);
 #endif
 }
 
@@ -151,7 +177,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -170,7 +196,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_END_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -183,22 +209,28 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
 #endif
 }
 
 void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
-    for (uint8_t i = 0; i < leds; i++) {
-        set_led_color_rgb(ledarray[i], i);
+    uint8_t* tx = txbuf[txbuf_next];
+    for (uint16_t i = 0; i < leds; i++) {
+        set_led_color_rgb(tx, ledarray[i], i);
     }
 
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
     // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
 #ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
 #    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, tx);
 #    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+#        if TXBUF_COUNT > 1
+    // The previous frame was sent from the other buffer, so only wait if it has not been clocked out yet
+    chBSemWait(&txbuf_sent);
+    txbuf_next ^= 1;
+#        endif
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, tx);
 #    endif
 #endif
 }
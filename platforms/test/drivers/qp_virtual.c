@@ -0,0 +1,289 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+
+#include "qp_virtual.h"
+#include "qp_surface_internal.h"
+
+typedef struct virtual_painter_device_t {
+    surface_painter_device_t       surface; // must be first, so the surface routines can draw into it
+    const painter_driver_vtable_t *inner;   // The surface's own vtable, which does the actual drawing
+    qp_virtual_stats_t             stats;
+
+    // Timing of the API call in progress
+    uint8_t  call_depth;
+    uint64_t call_start_ns;
+    uint64_t call_start_cycles;
+} virtual_painter_device_t;
+
+static virtual_painter_device_t devices[QP_VIRTUAL_NUM_DEVICES];
+
+static uint64_t read_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static uint64_t read_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void count_pixels(virtual_painter_device_t *virt, uint32_t native_pixel_count) {
+    virt->stats.pixdata_calls++;
+    virt->stats.pixels += native_pixel_count;
+    virt->stats.bytes += (native_pixel_count * virt->surface.base.native_bits_per_pixel + 7) / 8;
+}
+
+////////////////////////////////////////////////////
+// Driver vtable, counting and forwarding to the surface underneath
+
+static bool virtual_init(painter_device_t device, painter_rotation_t rotation) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    return virt->inner->init(device, rotation);
+}
+
+static bool virtual_power(painter_device_t device, bool power_on) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    return virt->inner->power(device, power_on);
+}
+
+static bool virtual_clear(painter_device_t device) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    return virt->inner->clear(device);
+}
+
+static bool virtual_flush(painter_device_t device) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    return virt->inner->flush(device);
+}
+
+static bool virtual_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    virt->stats.viewports++;
+    return virt->inner->viewport(device, left, top, right, bottom);
+}
+
+static bool virtual_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    count_pixels(virt, native_pixel_count);
+    return virt->inner->pixdata(device, pixel_data, native_pixel_count);
+}
+
+static bool virtual_pixfill(painter_device_t device, const void *native_pixel, uint32_t native_pixel_count) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    count_pixels(virt, native_pixel_count);
+    return virt->inner->pixfill(device, native_pixel, native_pixel_count);
+}
+
+static bool virtual_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    return virt->inner->palette_convert(device, palette_size, palette);
+}
+
+static bool virtual_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    return virt->inner->append_pixels(device, target_buffer, palette, pixel_offset, pixel_count, palette_indices);
+}
+
+static bool virtual_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    return virt->inner->append_pixdata(device, target_buffer, pixdata_offset, pixdata_byte);
+}
+
+static bool virtual_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)surface_driver;
+    return ((const surface_painter_driver_vtable_t *)virt->inner)->target_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface);
+}
+
+static const surface_painter_driver_vtable_t virtual_driver_vtable = {
+    .base =
+        {
+            .init            = virtual_init,
+            .power           = virtual_power,
+            .clear           = virtual_clear,
+            .flush           = virtual_flush,
+            .pixdata         = virtual_pixdata,
+            .viewport        = virtual_viewport,
+            .palette_convert = virtual_palette_convert,
+            .append_pixels   = virtual_append_pixels,
+            .append_pixdata  = virtual_append_pixdata,
+            .pixfill         = virtual_pixfill,
+        },
+    .target_pixdata_transfer = virtual_target_pixdata_transfer,
+};
+
+// The same, for standing in for panels that can't repeat a pixel themselves
+static const surface_painter_driver_vtable_t virtual_driver_vtable_without_pixfill = {
+    .base =
+        {
+            .init            = virtual_init,
+            .power           = virtual_power,
+            .clear           = virtual_clear,
+            .flush           = virtual_flush,
+            .pixdata         = virtual_pixdata,
+            .viewport        = virtual_viewport,
+            .palette_convert = virtual_palette_convert,
+            .append_pixels   = virtual_append_pixels,
+            .append_pixdata  = virtual_append_pixdata,
+            .pixfill         = NULL,
+        },
+    .target_pixdata_transfer = virtual_target_pixdata_transfer,
+};
+
+////////////////////////////////////////////////////
+// Comms vtable, timing each API call between start and stop
+
+static bool virtual_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool virtual_comms_start(painter_device_t device) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    if (virt->call_depth++ == 0) {
+        virt->call_start_ns     = read_ns();
+        virt->call_start_cycles = read_cycles();
+    }
+    return true;
+}
+
+static void virtual_comms_stop(painter_device_t device) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    if (virt->call_depth > 0 && --virt->call_depth == 0) {
+        virt->stats.calls++;
+        virt->stats.ns += read_ns() - virt->call_start_ns;
+        virt->stats.cycles += read_cycles() - virt->call_start_cycles;
+    }
+}
+
+static uint32_t virtual_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    virt->stats.bytes += byte_count;
+    return byte_count;
+}
+
+static const painter_comms_vtable_t virtual_comms_vtable = {
+    .comms_init  = virtual_comms_init,
+    .comms_start = virtual_comms_start,
+    .comms_stop  = virtual_comms_stop,
+    .comms_send  = virtual_comms_send,
+};
+
+////////////////////////////////////////////////////
+// Factories
+
+typedef painter_device_t (*surface_factory_t)(surface_painter_device_t *device_table, size_t device_table_len, uint16_t panel_width, uint16_t panel_height, void *buffer);
+
+static painter_device_t make_device(surface_factory_t factory, uint8_t bpp, uint16_t panel_width, uint16_t panel_height) {
+    for (uint8_t i = 0; i < QP_VIRTUAL_NUM_DEVICES; i++) {
+        virtual_painter_device_t *virt = &devices[i];
+        if (virt->inner) {
+            continue;
+        }
+
+        void *buffer = calloc(1, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, bpp));
+        if (!buffer) {
+            return NULL;
+        }
+
+        // Let the surface set itself up in our slot, then sit in front of it
+        memset(virt, 0, sizeof(*virt));
+        if (!factory(&virt->surface, 1, panel_width, panel_height, buffer)) {
+            free(buffer);
+            return NULL;
+        }
+        virt->inner                      = virt->surface.base.driver_vtable;
+        virt->surface.base.driver_vtable = &virtual_driver_vtable.base;
+        virt->surface.base.comms_vtable  = &virtual_comms_vtable;
+        return (painter_device_t)virt;
+    }
+    return NULL;
+}
+
+painter_device_t qp_virtual_make_rgb565_device(uint16_t panel_width, uint16_t panel_height) {
+    return make_device(qp_make_rgb565_surface_advanced, 16, panel_width, panel_height);
+}
+
+painter_device_t qp_virtual_make_mono1bpp_device(uint16_t panel_width, uint16_t panel_height) {
+    return make_device(qp_make_mono1bpp_surface_advanced, 1, panel_width, panel_height);
+}
+
+void qp_virtual_set_pixfill(painter_device_t device, bool enabled) {
+    virtual_painter_device_t *virt   = (virtual_painter_device_t *)device;
+    virt->surface.base.driver_vtable = enabled ? &virtual_driver_vtable.base : &virtual_driver_vtable_without_pixfill.base;
+}
+
+////////////////////////////////////////////////////
+// Inspection
+
+void qp_virtual_reset(void) {
+    for (uint8_t i = 0; i < QP_VIRTUAL_NUM_DEVICES; i++) {
+        free(devices[i].surface.buffer);
+    }
+    memset(devices, 0, sizeof(devices));
+}
+
+void qp_virtual_get_stats(painter_device_t device, qp_virtual_stats_t *stats) {
+    *stats = ((virtual_painter_device_t *)device)->stats;
+}
+
+void qp_virtual_clear_stats(painter_device_t device) {
+    memset(&((virtual_painter_device_t *)device)->stats, 0, sizeof(qp_virtual_stats_t));
+}
+
+RGB qp_virtual_get_pixel(painter_device_t device, uint16_t x, uint16_t y) {
+    virtual_painter_device_t *virt = (virtual_painter_device_t *)device;
+    painter_driver_t         *base = &virt->surface.base;
+    if (x >= base->panel_width || y >= base->panel_height) {
+        return (RGB){0};
+    }
+
+    uint32_t pixel = (uint32_t)y * base->panel_width + x;
+    if (base->native_bits_per_pixel == 1) {
+        uint8_t level = (virt->surface.u8buffer[pixel / 8] & (1 << (pixel % 8))) ? 255 : 0;
+        return (RGB){.r = level, .g = level, .b = level};
+    }
+
+    // The RGB565 surface keeps pixels byte-swapped, ready to send to a panel
+    uint16_t rgb565 = (virt->surface.u8buffer[pixel * 2] << 8) | virt->surface.u8buffer[pixel * 2 + 1];
+    uint8_t  r      = (rgb565 >> 11) & 0x1F;
+    uint8_t  g      = (rgb565 >> 5) & 0x3F;
+    uint8_t  b      = rgb565 & 0x1F;
+    return (RGB){.r = (r << 3) | (r >> 2), .g = (g << 2) | (g >> 4), .b = (b << 3) | (b >> 2)};
+}
+
+bool qp_virtual_write_ppm(painter_device_t device, const char *path, uint8_t scale) {
+    painter_driver_t *base = (painter_driver_t *)device;
+
+    if (scale == 0) {
+        scale = 1;
+    }
+
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+
+    uint32_t width  = (uint32_t)base->panel_width * scale;
+    uint32_t height = (uint32_t)base->panel_height * scale;
+    bool     ok     = fprintf(file, "P6\n%lu %lu\n255\n", (unsigned long)width, (unsigned long)height) > 0;
+    for (uint32_t y = 0; ok && y < height; y++) {
+        for (uint32_t x = 0; ok && x < width; x++) {
+            RGB     pixel = qp_virtual_get_pixel(device, x / scale, y / scale);
+            uint8_t rgb[] = {pixel.r, pixel.g, pixel.b};
+            ok            = fwrite(rgb, sizeof(rgb), 1, file) == 1;
+        }
+    }
+
+    return fclose(file) == 0 && ok;
+}
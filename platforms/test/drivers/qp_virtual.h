@@ -0,0 +1,84 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/**
+ * @file qp_virtual.h
+ * @brief Virtual Quantum Painter panel for host tests and benchmarks.
+ *
+ * Provides RGB565 and 1bpp monochrome painter devices backed by an in-memory
+ * framebuffer, standing in for a real display. Drawing goes through the same
+ * driver calls a panel would see, and each one is counted: viewport changes,
+ * native pixels pushed and the bytes they would take on the bus. Every Quantum
+ * Painter API call that talks to the device is also timed, from the start to
+ * the stop of its comms, which covers all image and font decoding for it.
+ *
+ * The framebuffer can be read back per pixel or written out as a PPM image.
+ * Like surfaces, the panel keeps pixels in drawing coordinates and does not
+ * apply the rotation passed to qp_init().
+ */
+
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "color.h"
+#include "qp.h"
+
+#ifndef QP_VIRTUAL_NUM_DEVICES
+#    define QP_VIRTUAL_NUM_DEVICES 4 // Maximum number of virtual panels alive at once
+#endif // QP_VIRTUAL_NUM_DEVICES
+
+typedef struct qp_virtual_stats_t {
+    uint32_t calls;         // Quantum Painter API calls made against the device
+    uint32_t viewports;     // Number of viewport() calls
+    uint32_t pixdata_calls; // Number of pixdata() and pixfill() calls
+    uint32_t pixels;        // Native pixels pushed to the panel
+    uint32_t bytes;         // Bytes those pixels would take to send to a real panel
+    uint64_t ns;            // Time spent inside the API calls
+    uint64_t cycles;        // CPU cycles spent inside the API calls (from the TSC on x86, 0 elsewhere)
+} qp_virtual_stats_t;
+
+/**
+ * @brief Create a virtual RGB565 panel.
+ *
+ * @return the device handle, or NULL if QP_VIRTUAL_NUM_DEVICES are already in use
+ */
+painter_device_t qp_virtual_make_rgb565_device(uint16_t panel_width, uint16_t panel_height);
+
+/**
+ * @brief Create a virtual 1bpp monochrome panel, with set bits drawn white.
+ *
+ * @return the device handle, or NULL if QP_VIRTUAL_NUM_DEVICES are already in use
+ */
+painter_device_t qp_virtual_make_mono1bpp_device(uint16_t panel_width, uint16_t panel_height);
+
+/**
+ * @brief Choose whether the panel offers pixfill(), which it does by default. Without it, runs of a single color are
+ * sent through pixdata() like any other pixels.
+ */
+void qp_virtual_set_pixfill(painter_device_t device, bool enabled);
+
+/**
+ * @brief Release every virtual panel and its framebuffer.
+ */
+void qp_virtual_reset(void);
+
+void qp_virtual_get_stats(painter_device_t device, qp_virtual_stats_t *stats);
+void qp_virtual_clear_stats(painter_device_t device);
+
+/**
+ * @brief Get the colour of a pixel in the framebuffer.
+ */
+RGB qp_virtual_get_pixel(painter_device_t device, uint16_t x, uint16_t y);
+
+/**
+ * @brief Write the framebuffer to a binary PPM (P6) image, with every pixel
+ * drawn as `scale` pixels square.
+ *
+ * @return false if the file could not be written
+ */
+bool qp_virtual_write_ppm(painter_device_t device, const char *path, uint8_t scale);
@@ -0,0 +1,116 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdio.h>
+#include <string.h>
+
+#include "rgb_matrix_virtual.h"
+#include "rgb_matrix.h"
+
+#define CANVAS_MARGIN (RGB_MATRIX_VIRTUAL_LED_SIZE / 2)
+#define CANVAS_WIDTH (224 + 1 + 2 * CANVAS_MARGIN)
+#define CANVAS_HEIGHT (64 + 1 + 2 * CANVAS_MARGIN)
+
+static RGB                        pending[RGB_MATRIX_LED_COUNT];
+static RGB                        flushed[RGB_MATRIX_LED_COUNT];
+static rgb_matrix_virtual_stats_t stats;
+
+////////////////////////////////////////////////////
+// rgb_matrix_driver_t implementation
+
+static void virtual_init(void) {
+    memset(pending, 0, sizeof(pending));
+    memset(flushed, 0, sizeof(flushed));
+}
+
+static void virtual_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    stats.set_color_calls++;
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+    pending[index] = (RGB){.r = red, .g = green, .b = blue};
+}
+
+static void virtual_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    stats.set_color_all_calls++;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        pending[i] = (RGB){.r = red, .g = green, .b = blue};
+    }
+}
+
+static void virtual_flush(void) {
+    stats.flushes++;
+    memcpy(flushed, pending, sizeof(flushed));
+}
+
+static void virtual_shutdown(void) {
+    stats.shutdowns++;
+}
+
+static void virtual_exit_shutdown(void) {
+    stats.wakeups++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = virtual_init,
+    .flush         = virtual_flush,
+    .set_color     = virtual_set_color,
+    .set_color_all = virtual_set_color_all,
+    .shutdown      = virtual_shutdown,
+    .exit_shutdown = virtual_exit_shutdown,
+};
+
+////////////////////////////////////////////////////
+// Inspection
+
+void rgb_matrix_virtual_reset(void) {
+    virtual_init();
+    memset(&stats, 0, sizeof(stats));
+}
+
+RGB rgb_matrix_virtual_get_color(uint8_t index) {
+    if (index >= RGB_MATRIX_LED_COUNT) {
+        return (RGB){0};
+    }
+    return flushed[index];
+}
+
+void rgb_matrix_virtual_get_stats(rgb_matrix_virtual_stats_t *out) {
+    *out = stats;
+}
+
+bool rgb_matrix_virtual_write_ppm(const char *path, uint8_t scale) {
+    static RGB canvas[CANVAS_HEIGHT][CANVAS_WIDTH];
+
+    if (scale == 0) {
+        scale = 1;
+    }
+
+    memset(canvas, 0, sizeof(canvas));
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        // Leave a one unit gap around each LED so neighbours stay distinguishable
+        uint16_t left = g_led_config.point[i].x + 1;
+        uint16_t top  = g_led_config.point[i].y + 1;
+        for (uint16_t y = top; y < top + RGB_MATRIX_VIRTUAL_LED_SIZE - 1 && y < CANVAS_HEIGHT; y++) {
+            for (uint16_t x = left; x < left + RGB_MATRIX_VIRTUAL_LED_SIZE - 1 && x < CANVAS_WIDTH; x++) {
+                canvas[y][x] = flushed[i];
+            }
+        }
+    }
+
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+
+    bool ok = fprintf(file, "P6\n%d %d\n255\n", CANVAS_WIDTH * scale, CANVAS_HEIGHT * scale) > 0;
+    for (uint16_t y = 0; ok && y < CANVAS_HEIGHT * scale; y++) {
+        for (uint16_t x = 0; ok && x < CANVAS_WIDTH * scale; x++) {
+            const RGB *pixel = &canvas[y / scale][x / scale];
+            uint8_t    rgb[] = {pixel->r, pixel->g, pixel->b};
+            ok               = fwrite(rgb, sizeof(rgb), 1, file) == 1;
+        }
+    }
+
+    return fclose(file) == 0 && ok;
+}
@@ -0,0 +1,57 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/**
+ * @file rgb_matrix_virtual.h
+ * @brief Virtual RGB matrix driver for host tests and benchmarks.
+ *
+ * Provides `rgb_matrix_driver` backed by two in-memory buffers that mirror a
+ * real LED driver: set_color()/set_color_all() write to a pending buffer and
+ * flush() copies it to the displayed one. The displayed frame can be read
+ * back per LED or written out as a PPM image, with each LED drawn at its
+ * `g_led_config` position.
+ */
+
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "color.h"
+
+#ifndef RGB_MATRIX_VIRTUAL_LED_SIZE
+#    define RGB_MATRIX_VIRTUAL_LED_SIZE 12 // Width of each LED in the PPM image, in g_led_config units
+#endif // RGB_MATRIX_VIRTUAL_LED_SIZE
+
+typedef struct rgb_matrix_virtual_stats_t {
+    uint32_t flushes;             // Number of flush() calls
+    uint32_t set_color_calls;     // Number of set_color() calls
+    uint32_t set_color_all_calls; // Number of set_color_all() calls
+    uint32_t shutdowns;           // Number of shutdown() calls
+    uint32_t wakeups;             // Number of exit_shutdown() calls
+} rgb_matrix_virtual_stats_t;
+
+/**
+ * @brief Clear both LED buffers and the statistics.
+ */
+void rgb_matrix_virtual_reset(void);
+
+/**
+ * @brief Get the colour of an LED as of the last flush.
+ */
+RGB rgb_matrix_virtual_get_color(uint8_t index);
+
+void rgb_matrix_virtual_get_stats(rgb_matrix_virtual_stats_t *stats);
+
+/**
+ * @brief Write the last flushed frame to a binary PPM (P6) image.
+ *
+ * The image covers the 224x64 `g_led_config` coordinate space plus a margin
+ * of half an LED, with every unit drawn as `scale` pixels square.
+ *
+ * @return false if the file could not be written
+ */
+bool rgb_matrix_virtual_write_ppm(const char *path, uint8_t scale);
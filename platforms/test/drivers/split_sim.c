@@ -0,0 +1,297 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_sim.h"
+#include "serial.h"
+#include "transport.h"
+#include "transactions.h"
+#include "split_util.h"
+#include "timer.h"
+
+// Provided by platforms/test/timer.c
+uint32_t timer_read_internal(void);
+void     set_time(uint32_t t);
+void     advance_time(uint32_t ms);
+
+typedef struct {
+    uint8_t *live;
+    uint8_t *other;
+    size_t   size;
+} split_sim_state_slot_t;
+
+static split_sim_link_config_t link_config = SPLIT_SIM_LINK_DEFAULTS;
+static split_sim_link_stats_t  link_stats;
+static uint32_t                link_prng;
+static uint32_t                link_pending_us;
+
+static bool master_ready = false;
+static bool slave_ready  = false;
+static bool in_slave     = false;
+
+static int32_t slave_clock_offset_ms = 0;
+static int32_t slave_clock_skew_ppm  = 0;
+
+// Holds whichever half's shared memory is not currently live in `split_shmem`
+static split_shared_memory_t other_shmem;
+
+static split_sim_state_slot_t state_slots[SPLIT_SIM_MAX_STATE_SLOTS];
+static uint8_t                state_slot_count = 0;
+static uint8_t                state_pool[SPLIT_SIM_STATE_POOL_SIZE];
+static size_t                 state_pool_used = 0;
+
+////////////////////////////////////////////////////
+// Helpers
+
+static uint32_t link_rand(void) {
+    // xorshift32, deterministic for a given seed
+    link_prng ^= link_prng << 13;
+    link_prng ^= link_prng >> 17;
+    link_prng ^= link_prng << 5;
+    return link_prng;
+}
+
+static bool link_one_in(uint16_t n) {
+    return n && (link_rand() % n) == 0;
+}
+
+static void link_spend_us(uint32_t us) {
+    link_stats.link_time_us += us;
+    link_pending_us += us;
+    if (link_pending_us >= 1000) {
+        advance_time(link_pending_us / 1000);
+        link_pending_us %= 1000;
+    }
+}
+
+static void link_spend_bytes(uint32_t count) {
+    // 8N1 framing, so ten bits on the wire per byte
+    uint32_t baud = link_config.baud ? link_config.baud : 1;
+    link_spend_us((uint32_t)(((uint64_t)count * 10 * 1000000UL) / baud));
+}
+
+static void link_copy(uint8_t *dest, const uint8_t *src, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        uint8_t b = src[i];
+        if (link_one_in(link_config.corrupt_one_in)) {
+            b ^= 1 << (link_rand() & 7);
+            link_stats.corrupted_bytes++;
+        }
+        dest[i] = b;
+    }
+    link_spend_bytes(length);
+}
+
+static void swap_bytes(uint8_t *a, uint8_t *b, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        uint8_t t = a[i];
+        a[i]      = b[i];
+        b[i]      = t;
+    }
+}
+
+static void swap_halves(void) {
+    swap_bytes((uint8_t *)split_shmem, (uint8_t *)&other_shmem, sizeof(split_shared_memory_t));
+    for (uint8_t i = 0; i < state_slot_count; ++i) {
+        swap_bytes(state_slots[i].live, state_slots[i].other, state_slots[i].size);
+    }
+}
+
+static uint32_t slave_time_for(uint32_t master_time) {
+    int64_t skew = ((int64_t)master_time * slave_clock_skew_ppm) / 1000000;
+    return (uint32_t)((int64_t)master_time + slave_clock_offset_ms + skew);
+}
+
+static bool enter_slave(uint32_t *master_time, uint32_t *slave_time) {
+    if (in_slave) {
+        return false;
+    }
+    *master_time = timer_read_internal();
+    *slave_time  = slave_time_for(*master_time);
+    swap_halves();
+    in_slave = true;
+    set_time(*slave_time);
+    return true;
+}
+
+static void leave_slave(uint32_t master_time, uint32_t slave_time) {
+    // Anything the slave spent waiting is also time passing for the master
+    uint32_t spent = timer_read_internal() - slave_time;
+    in_slave       = false;
+    swap_halves();
+    set_time(master_time + spent);
+}
+
+////////////////////////////////////////////////////
+// Role overrides
+
+bool is_keyboard_master(void) {
+    return !in_slave;
+}
+
+bool is_keyboard_left(void) {
+    return !in_slave;
+}
+
+bool split_sim_in_slave_context(void) {
+    return in_slave;
+}
+
+////////////////////////////////////////////////////
+// drivers/serial.h implementation
+
+void soft_serial_initiator_init(void) {
+    master_ready = true;
+}
+
+void soft_serial_target_init(void) {
+    slave_ready = true;
+}
+
+static bool link_transaction(int sstd_index, uint16_t timeout_ms) {
+    link_stats.transactions++;
+
+    if (sstd_index < 0 || sstd_index >= NUM_TOTAL_TRANSACTIONS || !master_ready) {
+        link_stats.failed++;
+        return false;
+    }
+    link_stats.by_id[sstd_index]++;
+
+    // Handshake: the transaction ID goes out and comes back XORed
+    link_stats.bytes_to_slave++;
+    link_spend_bytes(1);
+    if (!link_config.connected || !slave_ready || link_one_in(link_config.drop_one_in)) {
+        link_spend_us((uint32_t)timeout_ms * 1000);
+        link_stats.failed++;
+        return false;
+    }
+    link_stats.bytes_to_master++;
+    link_spend_bytes(1);
+    link_spend_us(link_config.latency_us);
+
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+
+    if (trans->initiator2target_buffer_size) {
+        link_copy((uint8_t *)&other_shmem + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        link_stats.bytes_to_slave += trans->initiator2target_buffer_size;
+    }
+
+    if (trans->slave_callback) {
+        uint32_t master_time, slave_time;
+        bool     entered = enter_slave(&master_time, &slave_time);
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        if (entered) {
+            leave_slave(master_time, slave_time);
+        }
+    }
+
+    if (trans->target2initiator_buffer_size) {
+        link_copy(split_trans_target2initiator_buffer(trans), (uint8_t *)&other_shmem + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+        link_stats.bytes_to_master += trans->target2initiator_buffer_size;
+    }
+
+    return true;
+}
+
+bool soft_serial_transaction(int sstd_index) {
+    return link_transaction(sstd_index, link_config.timeout_ms);
+}
+
+bool soft_serial_probe(int sstd_index, uint16_t timeout_ms) {
+    return link_transaction(sstd_index, timeout_ms < link_config.timeout_ms ? timeout_ms : link_config.timeout_ms);
+}
+
+////////////////////////////////////////////////////
+// Simulator control
+
+void split_sim_init(void) {
+    if (in_slave) {
+        in_slave = false;
+        swap_halves();
+    }
+    state_slot_count = 0;
+    state_pool_used  = 0;
+
+    memset(split_shmem, 0, sizeof(split_shared_memory_t));
+    memset(&other_shmem, 0, sizeof(split_shared_memory_t));
+
+    link_config     = (split_sim_link_config_t)SPLIT_SIM_LINK_DEFAULTS;
+    link_prng       = link_config.seed;
+    link_pending_us = 0;
+    memset(&link_stats, 0, sizeof(link_stats));
+
+    slave_clock_offset_ms = 0;
+    slave_clock_skew_ppm  = 0;
+
+    master_ready = false;
+    slave_ready  = false;
+
+    transport_master_init();
+
+    uint32_t master_time, slave_time;
+    enter_slave(&master_time, &slave_time);
+    transport_slave_init();
+    leave_slave(master_time, slave_time);
+}
+
+void split_sim_set_link(const split_sim_link_config_t *config) {
+    link_config = *config;
+    link_prng   = config->seed ? config->seed : 1;
+}
+
+void split_sim_get_link(split_sim_link_config_t *config) {
+    *config = link_config;
+}
+
+void split_sim_set_connected(bool connected) {
+    link_config.connected = connected;
+}
+
+void split_sim_get_stats(split_sim_link_stats_t *stats) {
+    *stats = link_stats;
+}
+
+void split_sim_reset_stats(void) {
+    memset(&link_stats, 0, sizeof(link_stats));
+}
+
+void split_sim_set_slave_clock(int32_t offset_ms, int32_t skew_ppm) {
+    slave_clock_offset_ms = offset_ms;
+    slave_clock_skew_ppm  = skew_ppm;
+}
+
+bool split_sim_register_state(void *ptr, size_t size) {
+    if (in_slave || state_slot_count >= SPLIT_SIM_MAX_STATE_SLOTS || state_pool_used + size > sizeof(state_pool)) {
+        return false;
+    }
+    split_sim_state_slot_t *slot = &state_slots[state_slot_count++];
+    slot->live                   = ptr;
+    slot->other                  = &state_pool[state_pool_used];
+    slot->size                   = size;
+    memcpy(slot->other, slot->live, size);
+    state_pool_used += size;
+    return true;
+}
+
+bool split_sim_master_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    return transport_master_if_connected(master_matrix, slave_matrix);
+}
+
+void split_sim_slave_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    uint32_t master_time, slave_time;
+    bool     entered = enter_slave(&master_time, &slave_time);
+    transport_slave(master_matrix, slave_matrix);
+    if (entered) {
+        leave_slave(master_time, slave_time);
+    }
+}
+
+void split_sim_run_on_slave(void (*fn)(void *arg), void *arg) {
+    uint32_t master_time, slave_time;
+    bool     entered = enter_slave(&master_time, &slave_time);
+    fn(arg);
+    if (entered) {
+        leave_slave(master_time, slave_time);
+    }
+}
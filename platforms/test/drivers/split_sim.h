@@ -0,0 +1,109 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/**
+ * @file split_sim.h
+ * @brief In-process split keyboard simulator for host tests and benchmarks.
+ *
+ * Runs both halves of a split keyboard inside one process. The simulator
+ * implements the `drivers/serial.h` transport API on top of an emulated
+ * half-duplex serial link, keeps a separate copy of the split shared memory
+ * for each half and switches between them whenever execution moves from one
+ * half to the other.
+ *
+ * Only the split shared memory, the keyboard role and the local clock are
+ * swapped automatically. Any other global state that differs between the two
+ * halves (layer state, mods, lighting config...) can be registered with
+ * split_sim_register_state() so that each half gets its own copy.
+ */
+
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "matrix.h"
+
+#ifndef SPLIT_SIM_STATE_POOL_SIZE
+#    define SPLIT_SIM_STATE_POOL_SIZE 1024
+#endif // SPLIT_SIM_STATE_POOL_SIZE
+
+#ifndef SPLIT_SIM_MAX_STATE_SLOTS
+#    define SPLIT_SIM_MAX_STATE_SLOTS 16
+#endif // SPLIT_SIM_MAX_STATE_SLOTS
+
+typedef struct split_sim_link_config_t {
+    uint32_t baud;           // Link speed in bits per second, 10 bits are used per byte (8N1)
+    uint16_t latency_us;     // Fixed turnaround cost added to every transaction
+    uint16_t timeout_ms;     // Time the master waits for a handshake that never arrives
+    uint16_t drop_one_in;    // Fail one in N transactions at the handshake, 0 disables
+    uint16_t corrupt_one_in; // Flip a bit in one in N transferred payload bytes, 0 disables
+    uint32_t seed;           // Seed for the error injection PRNG
+    bool     connected;      // Whether the cable is plugged in at all
+} split_sim_link_config_t;
+
+typedef struct split_sim_link_stats_t {
+    uint32_t transactions;    // Transactions initiated by the master
+    uint32_t failed;          // Transactions that did not complete
+    uint32_t corrupted_bytes; // Payload bytes altered by error injection
+    uint32_t bytes_to_slave;  // Bytes sent master -> slave, handshake included
+    uint32_t bytes_to_master; // Bytes sent slave -> master, handshake included
+    uint64_t link_time_us;    // Total simulated time spent on the wire
+    uint32_t by_id[32];       // Transactions initiated, per transaction ID
+} split_sim_link_stats_t;
+
+// clang-format off
+#define SPLIT_SIM_LINK_DEFAULTS {.baud = 460800, .latency_us = 20, .timeout_ms = 20, .drop_one_in = 0, .corrupt_one_in = 0, .seed = 0x5EED, .connected = true}
+// clang-format on
+
+/**
+ * @brief Reset the link, both shared memory images and all registered state,
+ * then run the master and slave transport initialisation in their contexts.
+ */
+void split_sim_init(void);
+
+void split_sim_set_link(const split_sim_link_config_t *config);
+void split_sim_get_link(split_sim_link_config_t *config);
+void split_sim_set_connected(bool connected);
+
+void split_sim_get_stats(split_sim_link_stats_t *stats);
+void split_sim_reset_stats(void);
+
+/**
+ * @brief Configure the slave's local clock relative to the master's.
+ *
+ * The slave observes `timer_read32()` as `offset_ms + t * (1 + skew_ppm / 1e6)`
+ * where `t` is the master's time, which lets tests exercise sync timer drift.
+ */
+void split_sim_set_slave_clock(int32_t offset_ms, int32_t skew_ppm);
+
+/**
+ * @brief Give each half its own copy of a global variable.
+ *
+ * The current contents of `ptr` become the initial value for both halves.
+ * Returns false if the slot table or state pool is exhausted.
+ */
+bool split_sim_register_state(void *ptr, size_t size);
+
+/**
+ * @brief Run one master scan cycle worth of split transactions, including the
+ * connection tracking in `transport_master_if_connected()`.
+ */
+bool split_sim_master_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+/**
+ * @brief Run the slave's per-scan split processing in the slave context.
+ */
+void split_sim_slave_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+/**
+ * @brief Execute an arbitrary callback in the slave context, e.g. to inspect
+ * or modify slave-side state from a test.
+ */
+void split_sim_run_on_slave(void (*fn)(void *arg), void *arg);
+
+bool split_sim_in_slave_context(void);
@@ -19,84 +19,65 @@
 #include "progmem.h"
 #include "util.h"
 
-RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
-    RGB      rgb;
-    uint8_t  region, remainder, p, q, t;
-    uint16_t h, s, v;
-
-    if (hsv.s == 0) {
-#ifdef USE_CIE1931_CURVE
-        if (use_cie) {
-            rgb.r = rgb.g = rgb.b = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-        } else {
-            rgb.r = hsv.v;
-            rgb.g = hsv.v;
-            rgb.b = hsv.v;
-        }
-#else
-        rgb.r = hsv.v;
-        rgb.g = hsv.v;
-        rgb.b = hsv.v;
-#endif
-        return rgb;
-    }
+// Which of v, p, q and t goes to the red, green and blue channels in each
+// sixth of the hue circle. Hue 255 lands in a seventh sector equal to the first.
+static const uint8_t hsv_sector_channels[7][3] = {
+    {0, 3, 1}, // v, t, p
+    {2, 0, 1}, // q, v, p
+    {1, 0, 3}, // p, v, t
+    {1, 2, 0}, // p, q, v
+    {3, 1, 0}, // t, p, v
+    {0, 1, 2}, // v, p, q
+    {0, 3, 1}, // v, t, p
+};
 
-    h = hsv.h;
-    s = hsv.s;
+static inline uint8_t hsv_value(uint8_t v, bool use_cie) {
 #ifdef USE_CIE1931_CURVE
     if (use_cie) {
-        v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-    } else {
-        v = hsv.v;
+        return pgm_read_byte(&CIE1931_CURVE[v]);
     }
-#else
-    v = hsv.v;
 #endif
+    return v;
+}
 
-    region    = h * 6 / 255;
-    remainder = (h * 2 - region * 85) * 3;
-
-    p = (v * (255 - s)) >> 8;
-    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
-    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+static inline RGB hsv_to_rgb_fixed(uint8_t h, uint8_t s, uint8_t v) {
+    RGB rgb;
 
-    switch (region) {
-        case 6:
-        case 0:
-            rgb.r = v;
-            rgb.g = t;
-            rgb.b = p;
-            break;
-        case 1:
-            rgb.r = q;
-            rgb.g = v;
-            rgb.b = p;
-            break;
-        case 2:
-            rgb.r = p;
-            rgb.g = v;
-            rgb.b = t;
-            break;
-        case 3:
-            rgb.r = p;
-            rgb.g = q;
-            rgb.b = v;
-            break;
-        case 4:
-            rgb.r = t;
-            rgb.g = p;
-            rgb.b = v;
-            break;
-        default:
-            rgb.r = v;
-            rgb.g = p;
-            rgb.b = q;
-            break;
+    if (s == 0) {
+        rgb.r = v;
+        rgb.g = v;
+        rgb.b = v;
+        return rgb;
     }
 
+    // h * 6 / 255 without a division
+    uint16_t h6        = h * 6;
+    uint8_t  region    = (h6 + (h6 >> 8) + 1) >> 8;
+    uint8_t  remainder = (h * 2 - region * 85) * 3;
+
+    uint8_t c[4];
+    c[0] = v;
+    c[1] = (v * (255 - s)) >> 8;
+    c[2] = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    c[3] = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    const uint8_t *channels = hsv_sector_channels[region];
+    rgb.r                   = c[channels[0]];
+    rgb.g                   = c[channels[1]];
+    rgb.b                   = c[channels[2]];
     return rgb;
 }
 
+RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
+    return hsv_to_rgb_fixed(hsv.h, hsv.s, hsv_value(hsv.v, use_cie));
+}
+
+static void hsv_to_rgb_batch_impl(const HSV *hsv, RGB *rgb, uint8_t count, bool use_cie) {
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = hsv_to_rgb_fixed(hsv[i].h, hsv[i].s, hsv_value(hsv[i].v, use_cie));
+    }
+}
+
 RGB hsv_to_rgb(HSV hsv) {
 #ifdef USE_CIE1931_CURVE
     return hsv_to_rgb_impl(hsv, true);
@@ -109,6 +90,18 @@ RGB hsv_to_rgb_nocie(HSV hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
 
+void hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count) {
+#ifdef USE_CIE1931_CURVE
+    hsv_to_rgb_batch_impl(hsv, rgb, count, true);
+#else
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+#endif
+}
+
+void hsv_to_rgb_batch_nocie(const HSV *hsv, RGB *rgb, uint8_t count) {
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+}
+
 #ifdef WS2812_RGBW
 void convert_rgb_to_rgbw(rgb_led_t *led) {
     // Determine lowest value in all three colors, put that into
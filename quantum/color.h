@@ -111,6 +111,9 @@ typedef struct PACKED HSV {
 
 RGB hsv_to_rgb(HSV hsv);
 RGB hsv_to_rgb_nocie(HSV hsv);
+// Convert `count` colours at once, same results as calling hsv_to_rgb() on each
+void hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count);
+void hsv_to_rgb_batch_nocie(const HSV *hsv, RGB *rgb, uint8_t count);
 #ifdef WS2812_RGBW
 void convert_rgb_to_rgbw(rgb_led_t *led);
 #endif
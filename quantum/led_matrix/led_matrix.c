@@ -74,6 +74,7 @@ static uint8_t         led_last_enable   = UINT8_MAX;
 static uint8_t         led_last_effect   = UINT8_MAX;
 static effect_params_t led_effect_params = {0, LED_FLAG_ALL, false};
 static led_task_states led_task_state    = SYNCING;
+static bool            led_driver_asleep = false;
 
 // double buffers
 static uint32_t led_timer_buffer;
@@ -315,18 +316,54 @@ static void led_task_flush(uint8_t effect) {
     led_task_state = SYNCING;
 }
 
+static void led_task_blank(void) {
+    // Going dark isn't a change of effect, so keep the current one from being reinitialised afterwards
+    uint8_t last_effect = led_last_effect;
+    led_task_render(0);
+    led_task_flush(0);
+    led_last_effect = last_effect;
+}
+
+static void led_task_sleep(void) {
+    if (!led_driver_asleep) {
+        // Blank the LEDs once, then leave the driver alone until woken
+        led_task_blank();
+        if (led_matrix_driver.shutdown) {
+            led_matrix_driver.shutdown();
+        }
+        led_driver_asleep = true;
+    }
+    eeconfig_flush_led_matrix(false);
+}
+
+static void led_task_wake(void) {
+    if (led_matrix_driver.exit_shutdown) {
+        led_matrix_driver.exit_shutdown();
+    }
+    led_driver_asleep = false;
+    led_task_state    = STARTING;
+}
+
 void led_matrix_task(void) {
     led_task_timers();
 
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
 #if LED_MATRIX_TIMEOUT > 0
                              (last_input_activity_elapsed() > (uint32_t)LED_MATRIX_TIMEOUT) ||
 #endif // LED_MATRIX_TIMEOUT > 0
                              false;
 
-    uint8_t effect = suspend_backlight || !led_matrix_eeconfig.enable ? 0 : led_matrix_eeconfig.mode;
+    // While suspended or timed out the LEDs are dark and the driver is shut
+    // down, so there is nothing to render until there is activity again
+    if (suspend_backlight) {
+        led_task_sleep();
+        return;
+    }
+    if (led_driver_asleep) {
+        led_task_wake();
+    }
+
+    uint8_t effect = led_matrix_eeconfig.enable ? led_matrix_eeconfig.mode : 0;
 
     switch (led_task_state) {
         case STARTING:
@@ -436,8 +473,7 @@ void led_matrix_init(void) {
 void led_matrix_set_suspend_state(bool state) {
 #ifdef LED_MATRIX_SLEEP
     if (state && !suspend_state && is_keyboard_master()) { // only run if turning off, and only once
-        led_task_render(0);                                // turn off all LEDs when suspending
-        led_task_flush(0);                                 // and actually flash led state to LEDs
+        led_task_blank();                                  // turn off all LEDs when suspending
     }
     suspend_state = state;
 #endif
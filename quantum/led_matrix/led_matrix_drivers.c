@@ -16,13 +16,15 @@
  */
 
 #include "led_matrix_drivers.h"
+#include "led/led_shutdown.h"
 
 /* Each driver needs to define a struct:
  *
  *    const led_matrix_driver_t led_matrix_driver;
  *
- * All members must be provided. Keyboard custom drivers must define this
- * in their own files.
+ * All members must be provided, except shutdown and exit_shutdown which may
+ * be left NULL if the hardware has no low power state. Keyboard custom drivers
+ * must define this in their own files.
  */
 
 #if defined(LED_MATRIX_IS31FL3218)
@@ -31,102 +33,152 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3218_update_pwm_buffers,
     .set_value     = is31fl3218_set_value,
     .set_value_all = is31fl3218_set_value_all,
+    .shutdown      = is31fl3218_sw_shutdown,
+    .exit_shutdown = is31fl3218_sw_return_normal,
 };
 
 #elif defined(LED_MATRIX_IS31FL3236)
+LED_SHUTDOWN_DRIVERS(is31fl3236, IS31FL3236_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3236_init_drivers,
     .flush         = is31fl3236_flush,
     .set_value     = is31fl3236_set_value,
     .set_value_all = is31fl3236_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3729)
+LED_SHUTDOWN_DRIVERS(is31fl3729, IS31FL3729_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3729_init_drivers,
     .flush         = is31fl3729_flush,
     .set_value     = is31fl3729_set_value,
     .set_value_all = is31fl3729_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3731)
+LED_SHUTDOWN_DRIVERS(is31fl3731, IS31FL3731_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3731_init_drivers,
     .flush         = is31fl3731_flush,
     .set_value     = is31fl3731_set_value,
     .set_value_all = is31fl3731_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3733)
+LED_SHUTDOWN_DRIVERS(is31fl3733, IS31FL3733_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3733_init_drivers,
     .flush         = is31fl3733_flush,
     .set_value     = is31fl3733_set_value,
     .set_value_all = is31fl3733_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3736)
+LED_SHUTDOWN_DRIVERS(is31fl3736, IS31FL3736_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3736_init_drivers,
     .flush         = is31fl3736_flush,
     .set_value     = is31fl3736_set_value,
     .set_value_all = is31fl3736_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3737)
+LED_SHUTDOWN_DRIVERS(is31fl3737, IS31FL3737_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3737_init_drivers,
     .flush         = is31fl3737_flush,
     .set_value     = is31fl3737_set_value,
     .set_value_all = is31fl3737_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3741)
+LED_SHUTDOWN_DRIVERS(is31fl3741, IS31FL3741_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3741_init_drivers,
     .flush         = is31fl3741_flush,
     .set_value     = is31fl3741_set_value,
     .set_value_all = is31fl3741_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3742A)
+LED_SHUTDOWN_DRIVERS(is31fl3742a, IS31FL3742A_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3742a_init_drivers,
     .flush         = is31fl3742a_flush,
     .set_value     = is31fl3742a_set_value,
     .set_value_all = is31fl3742a_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3743A)
+LED_SHUTDOWN_DRIVERS(is31fl3743a, IS31FL3743A_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3743a_init_drivers,
     .flush         = is31fl3743a_flush,
     .set_value     = is31fl3743a_set_value,
     .set_value_all = is31fl3743a_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3745)
+LED_SHUTDOWN_DRIVERS(is31fl3745, IS31FL3745_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3745_init_drivers,
     .flush         = is31fl3745_flush,
     .set_value     = is31fl3745_set_value,
     .set_value_all = is31fl3745_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_IS31FL3746A)
+LED_SHUTDOWN_DRIVERS(is31fl3746a, IS31FL3746A_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3746a_init_drivers,
     .flush         = is31fl3746a_flush,
     .set_value     = is31fl3746a_set_value,
     .set_value_all = is31fl3746a_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(LED_MATRIX_SNLED27351)
+LED_SHUTDOWN_DRIVERS(snled27351, SNLED27351_DRIVER_COUNT)
+
 const led_matrix_driver_t led_matrix_driver = {
     .init          = snled27351_init_drivers,
     .flush         = snled27351_flush,
     .set_value     = snled27351_set_value,
     .set_value_all = snled27351_set_value_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #endif
@@ -43,6 +43,10 @@ typedef struct {
     void (*set_value_all)(uint8_t value);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional: put the hardware into its low power state once the LEDs are off. */
+    void (*shutdown)(void);
+    /* Optional: bring the hardware back out of shutdown. */
+    void (*exit_shutdown)(void);
 } led_matrix_driver_t;
 
 extern const led_matrix_driver_t led_matrix_driver;
@@ -57,6 +57,9 @@ bool qp_init(painter_device_t device, painter_rotation_t rotation) {
     // Set the rotation before init
     driver->rotation = rotation;
 
+    // Any palette converted for this device before (re)initialisation may not match its pixel format any more
+    qp_internal_invalidate_palette();
+
     // Invoke init
     bool ret = driver->driver_vtable->init(device, rotation);
     qp_comms_stop(device);
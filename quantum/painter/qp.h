@@ -64,6 +64,39 @@
 #    define QUANTUM_PAINTER_CONCURRENT_ANIMATIONS 4
 #endif // QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 
+#ifndef QUANTUM_PAINTER_ANIMATION_CACHE_SIZE
+/**
+ * @def This controls the amount of RAM, in bytes, used to keep decoded animation frames in the display's native pixel
+ *      format. Frames that fit are only decoded the first time they're shown, and copied straight to the display on
+ *      every later loop of the animation. Set to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_ANIMATION_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_ANIMATION_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_ANIMATION_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of frames kept in the animation cache, across all animations.
+ */
+#    define QUANTUM_PAINTER_ANIMATION_CACHE_ENTRIES 16
+#endif // QUANTUM_PAINTER_ANIMATION_CACHE_ENTRIES
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the amount of RAM, in bytes, used to keep rendered font glyphs in the display's native pixel
+ *      format. Cached glyphs are copied straight to the display the next time they're drawn in the same colors, and
+ *      their widths are reused when measuring text. Set to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of glyphs kept in the glyph cache, across all fonts and colors. The least
+ *      recently drawn glyphs are evicted first.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 32
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+
 #ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE
 /**
  * @def This controls the maximum size of the pixel data buffer used for single blocks of transmission. Larger buffers
@@ -88,6 +121,14 @@
 #    define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_SUPPORTS_LZ
+/**
+ * @def This controls whether LZ-compressed images and fonts are supported. Decoding needs a 1kB window of the most
+ *      recently decoded data to be kept in RAM.
+ */
+#    define QUANTUM_PAINTER_SUPPORTS_LZ FALSE
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter types
 
@@ -435,7 +476,7 @@ void qp_stop_animation(deferred_token anim_token);
  * @note Fonts can be unloaded by calling \ref qp_close_font.
  *
  * @param buffer[in] the font data to load
- * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_textmeasure, \ref qp_drawtext, and \ref qp_drawtext_recolor.
  * @return NULL if loading the font failed
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
@@ -458,6 +499,18 @@ bool qp_close_font(painter_font_handle_t font);
  */
 int16_t qp_textwidth(painter_font_handle_t font, const char *str);
 
+/**
+ * Measures the size (in pixels) of the supplied string, given the specified font.
+ *
+ * @param font[in] the handle of the font
+ * @param str[in] the string to measure
+ * @param width[out] the width (in pixels) needed to draw the specified string
+ * @param height[out] the height (in pixels) needed to draw the specified string
+ * @return true if measuring the string succeeded
+ * @return false if measuring the string failed
+ */
+bool qp_textmeasure(painter_font_handle_t font, const char *str, int16_t *width, int16_t *height);
+
 /**
  * Draws text to the display.
  *
@@ -21,6 +21,9 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device);
 // Fills the supplied buffer with equivalent native pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val);
 
+// append_pixels implementation shared by RGB565 drivers, whose palette_convert leaves each entry's native pixel in .rgb565
+bool qp_internal_append_pixels_rgb565(uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices);
+
 // qp_setpixel internal implementation, but uses the global pixdata buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 
@@ -36,6 +39,12 @@ bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count,
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg);
 
+// Same as above, but repeated input is passed on as a single run, so outputs can fill many pixels or bytes at once
+typedef bool (*qp_internal_pixel_run_output_callback)(qp_pixel_t* palette, uint8_t index, uint32_t count, void* cb_arg);
+typedef bool (*qp_internal_byte_run_output_callback)(uint8_t byte, uint32_t count, void* cb_arg);
+bool qp_internal_decode_palette_runs(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_run_output_callback output_callback, void* output_arg);
+bool qp_internal_send_byte_runs(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_run_output_callback output_callback, void* output_arg);
+
 // Global variable used for interpolated pixel lookup table.
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 extern qp_pixel_t qp_internal_global_pixel_lookup_table[256];
@@ -44,15 +53,15 @@ extern qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
 // Generates a color-interpolated lookup table based off the number of items, from foreground to background, for use with monochrome image rendering.
-// Returns true if a palette was created, false if the palette is reused.
-// As this uses a global, this may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() below to reset.
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
+// The table is converted to the device's native pixel format, and kept as-is while the same device, colors and number of items are requested.
+bool qp_internal_interpolate_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it gets regenerated and converted on next use. Needed whenever the asset it may have been loaded from goes away.
 void qp_internal_invalidate_palette(void);
 
-// Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
-bool qp_internal_load_qgf_palette(qp_stream_t* stream, uint8_t bpp);
+// Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset, converted to the device's native pixel format. Expects the stream to be positioned at the start of the block header, and leaves it after the end of the block.
+// Drawing from the same palette block on the same device again skips over the block and reuses the converted table.
+bool qp_internal_load_qgf_palette(painter_device_t device, qp_stream_t* stream, uint8_t bpp);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter codec functions
@@ -73,16 +82,30 @@ typedef struct qp_internal_byte_input_state_t {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            uint16_t remain;   // number of bytes remaining in the current literal run or match
+            uint16_t distance; // how far back the current match copies from, or 0 for a literal run
+        } lz;
     };
 } qp_internal_byte_input_state_t;
 
+// Number of palette indices from short runs collected by qp_internal_pixel_run_appender, before they're all converted to native pixels at once
+#define QP_PIXEL_BATCH_SIZE 32
+
 typedef struct qp_internal_pixel_output_state_t {
     painter_device_t device;
     uint32_t         pixel_write_pos;
     uint32_t         max_pixels;
+    uint8_t          batch_count; // number of batch_indices waiting to be written from pixel_write_pos onwards
+    uint8_t          batch_indices[QP_PIXEL_BATCH_SIZE];
 } qp_internal_pixel_output_state_t;
 
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+bool qp_internal_pixel_run_appender(qp_pixel_t* palette, uint8_t index, uint32_t count, void* cb_arg);
+
+// Sends everything qp_internal_pixel_run_appender has left over to the display
+bool qp_internal_pixel_run_appender_flush(qp_internal_pixel_output_state_t* state);
 
 typedef struct qp_internal_byte_output_state_t {
     painter_device_t device;
@@ -91,10 +114,14 @@ typedef struct qp_internal_byte_output_state_t {
 } qp_internal_byte_output_state_t;
 
 bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
+bool qp_internal_byte_run_appender(uint8_t byteval, uint32_t count, void* cb_arg);
 
 // Helper shared between image and font rendering, sends pixels to the display using:
-//     - qp_internal_decode_palette + qp_internal_pixel_appender (bpp <= 8)
-//     - qp_internal_send_bytes                                  (bpp > 8)
+//     - qp_internal_decode_palette_runs + qp_internal_pixel_run_appender (bpp <= 8)
+//     - qp_internal_send_byte_runs + qp_internal_byte_run_appender       (bpp > 8)
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
 
+// Same as qp_internal_appender, but decodes into the supplied buffer in the display's native pixel format, for later use with pixdata
+bool qp_internal_decode_to_buffer(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state, uint8_t* buffer);
+
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
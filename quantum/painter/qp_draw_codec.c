@@ -55,12 +55,9 @@ bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count,
 }
 
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    painter_driver_t* driver = (painter_driver_t*)device;
-    int16_t           steps  = 1 << bits_per_pixel; // number of items we need to interpolate
-    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps)) {
-        if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
-            return false;
-        }
+    int16_t steps = 1 << bits_per_pixel; // number of items we need to interpolate
+    if (!qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, steps)) {
+        return false;
     }
 
     return qp_internal_decode_palette(device, pixel_count, bits_per_pixel, input_callback, input_arg, qp_internal_global_pixel_lookup_table, output_callback, output_arg);
@@ -90,21 +87,25 @@ static inline int16_t qp_drawimage_byte_uncompressed_decoder(void* cb_arg) {
     return state->curr;
 }
 
+static inline void qp_drawimage_rle_read_marker(qp_internal_byte_input_state_t* state) {
+    uint8_t c = qp_stream_get(state->src_stream);
+    if (c >= 128) {
+        state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
+        state->rle.remain = c - 127;
+    } else {
+        state->rle.mode   = REPEATING_RUN; // repeated run
+        state->rle.remain = c;
+    }
+
+    state->curr = qp_stream_get(state->src_stream);
+}
+
 static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
 
     // Work out if we're parsing the initial marker byte
     if (state->rle.mode == MARKER_BYTE) {
-        uint8_t c = qp_stream_get(state->src_stream);
-        if (c >= 128) {
-            state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
-            state->rle.remain = c - 127;
-        } else {
-            state->rle.mode   = REPEATING_RUN; // repeated run
-            state->rle.remain = c;
-        }
-
-        state->curr = qp_stream_get(state->src_stream);
+        qp_drawimage_rle_read_marker(state);
     }
 
     // Work out which byte we're returning
@@ -126,6 +127,317 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+#if QUANTUM_PAINTER_SUPPORTS_LZ
+// The window size is part of the format -- matches can reach this far back into the decoded data
+#    define QP_LZ_WINDOW_SIZE 1024
+#    define QP_LZ_MIN_MATCH 3
+#    define QP_LZ_MAX_SHORT_MATCH 33
+
+static uint8_t  qp_internal_lz_window[QP_LZ_WINDOW_SIZE];
+static uint16_t qp_internal_lz_window_pos = 0;
+
+static inline bool qp_drawimage_lz_read_token(qp_internal_byte_input_state_t* state) {
+    int16_t token = qp_stream_get(state->src_stream);
+    if (token < 0) {
+        return false;
+    }
+
+    if (token < 0x80) {
+        state->lz.remain   = token + 1; // literal run
+        state->lz.distance = 0;
+        return true;
+    }
+
+    int16_t offset = qp_stream_get(state->src_stream);
+    if (offset < 0) {
+        return false;
+    }
+
+    uint16_t length = ((token >> 2) & 0x1F) + QP_LZ_MIN_MATCH;
+    if (length > QP_LZ_MAX_SHORT_MATCH) {
+        // Longer matches carry on in extra bytes, until one that isn't 255
+        int16_t extra;
+        do {
+            extra = qp_stream_get(state->src_stream);
+            if (extra < 0) {
+                return false;
+            }
+            length += extra;
+        } while (extra == 255);
+    }
+
+    state->lz.remain   = length;
+    state->lz.distance = (((token & 0x03) << 8) | offset) + 1;
+    return true;
+}
+
+static inline int16_t qp_drawimage_byte_lz_decoder(void* cb_arg) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+
+    if (state->lz.remain == 0 && !qp_drawimage_lz_read_token(state)) {
+        return STREAM_EOF;
+    }
+
+    int16_t c;
+    if (state->lz.distance == 0) {
+        c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return STREAM_EOF;
+        }
+    } else {
+        c = qp_internal_lz_window[(qp_internal_lz_window_pos + QP_LZ_WINDOW_SIZE - state->lz.distance) % QP_LZ_WINDOW_SIZE];
+    }
+
+    qp_internal_lz_window[qp_internal_lz_window_pos] = c;
+    qp_internal_lz_window_pos                        = (qp_internal_lz_window_pos + 1) % QP_LZ_WINDOW_SIZE;
+    state->lz.remain--;
+    state->curr = c;
+    return c;
+}
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ
+
+// Runs shorter than this are cheaper to batch up in the pixdata buffer than to send separately with pixfill
+#define QP_PIXFILL_MIN_RUN 8
+
+// Pulls the next byte, along with how many times it repeats (up to max_count). Only compressed input reports repeats.
+static int16_t qp_internal_take_byte_run(qp_internal_byte_input_callback input_callback, void* input_arg, uint32_t max_count, uint32_t* count) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)input_arg;
+    *count                                = 1;
+
+    if (input_callback == qp_drawimage_byte_rle_decoder) {
+        if (state->rle.mode == MARKER_BYTE) {
+            qp_drawimage_rle_read_marker(state);
+        }
+
+        if (state->rle.mode != REPEATING_RUN || state->rle.remain < 2 || max_count < 2) {
+            return qp_drawimage_byte_rle_decoder(input_arg);
+        }
+
+        *count = QP_MIN(state->rle.remain, max_count);
+        state->rle.remain -= *count;
+        if (state->rle.remain == 0) {
+            state->rle.mode = MARKER_BYTE;
+        }
+        return state->curr;
+    }
+
+#if QUANTUM_PAINTER_SUPPORTS_LZ
+    if (input_callback == qp_drawimage_byte_lz_decoder) {
+        // A match one byte back repeats the previous byte
+        if (state->lz.remain == 0 || state->lz.distance != 1 || state->lz.remain < 2 || max_count < 2) {
+            return qp_drawimage_byte_lz_decoder(input_arg);
+        }
+
+        uint8_t c = qp_internal_lz_window[(qp_internal_lz_window_pos + QP_LZ_WINDOW_SIZE - 1) % QP_LZ_WINDOW_SIZE];
+        *count    = QP_MIN(state->lz.remain, max_count);
+        state->lz.remain -= *count;
+
+        // Only the last window's worth of the run can ever be referenced again
+        for (uint32_t i = QP_MIN(*count, QP_LZ_WINDOW_SIZE); i > 0; --i) {
+            qp_internal_lz_window[qp_internal_lz_window_pos] = c;
+            qp_internal_lz_window_pos                        = (qp_internal_lz_window_pos + 1) % QP_LZ_WINDOW_SIZE;
+        }
+        state->curr = c;
+        return c;
+    }
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ
+
+    return input_callback(input_arg);
+}
+
+bool qp_internal_decode_palette_runs(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_run_output_callback output_callback, void* output_arg) {
+    const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
+    const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
+    const uint8_t uniform_multiple = 0xFF / pixel_bitmask; // byte value with every pixel in it set to index 1
+    uint32_t      remaining_pixels = pixel_count;
+    uint8_t       run_index        = 0;
+    uint32_t      run_length       = 0;
+    while (remaining_pixels > 0) {
+        uint32_t byte_count;
+        int16_t  byteval = qp_internal_take_byte_run(input_callback, input_arg, (remaining_pixels + pixels_per_byte - 1) / pixels_per_byte, &byte_count);
+        if (byteval < 0) {
+            return false;
+        }
+
+        uint8_t index = byteval & pixel_bitmask;
+        if (byte_count > 1 && byteval == index * uniform_multiple) {
+            // Every pixel in the repeated byte is the same, so they all extend one run
+            uint32_t loop_pixels = QP_MIN(byte_count * pixels_per_byte, remaining_pixels);
+            if (run_length > 0 && run_index != index) {
+                if (!output_callback(palette, run_index, run_length, output_arg)) {
+                    return false;
+                }
+                run_length = 0;
+            }
+            run_index = index;
+            run_length += loop_pixels;
+            remaining_pixels -= loop_pixels;
+            continue;
+        }
+
+        for (uint32_t b = 0; b < byte_count; ++b) {
+            uint8_t pixels      = byteval;
+            uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
+            for (uint8_t q = 0; q < loop_pixels; ++q) {
+                index = pixels & pixel_bitmask;
+                if (run_length > 0 && run_index != index) {
+                    if (!output_callback(palette, run_index, run_length, output_arg)) {
+                        return false;
+                    }
+                    run_length = 0;
+                }
+                run_index = index;
+                run_length++;
+                pixels >>= bits_per_pixel;
+            }
+            remaining_pixels -= loop_pixels;
+        }
+    }
+    return run_length == 0 || output_callback(palette, run_index, run_length, output_arg);
+}
+
+bool qp_internal_send_byte_runs(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_run_output_callback output_callback, void* output_arg) {
+    uint32_t remaining_bytes = byte_count;
+    while (remaining_bytes > 0) {
+        uint32_t count;
+        int16_t  byteval = qp_internal_take_byte_run(input_callback, input_arg, remaining_bytes, &count);
+        if (byteval < 0) {
+            return false;
+        }
+        if (!output_callback(byteval, count, output_arg)) {
+            return false;
+        }
+        remaining_bytes -= count;
+    }
+    return true;
+}
+
+// Writes count copies of a palette entry at the given pixel offset, converting it once and copying the native bytes
+static bool qp_internal_fill_pixel_run(painter_device_t device, uint8_t* target_buffer, qp_pixel_t* palette, uint8_t index, uint32_t pixel_offset, uint32_t count) {
+    painter_driver_t* driver      = (painter_driver_t*)device;
+    const uint8_t     pixel_bytes = driver->native_bits_per_pixel / 8;
+
+    // Pixels that don't fill whole bytes have to be packed one at a time
+    if (driver->native_bits_per_pixel % 8 != 0) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!driver->driver_vtable->append_pixels(device, target_buffer, palette, pixel_offset + i, 1, &index)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (!driver->driver_vtable->append_pixels(device, target_buffer, palette, pixel_offset, 1, &index)) {
+        return false;
+    }
+
+    // Keep doubling up what's been written until the run is filled
+    uint8_t* run    = &target_buffer[pixel_offset * pixel_bytes];
+    uint32_t total  = count * pixel_bytes;
+    uint32_t filled = pixel_bytes;
+    while (filled < total) {
+        uint32_t copy = QP_MIN(filled, total - filled);
+        memcpy(&run[filled], run, copy);
+        filled += copy;
+    }
+    return true;
+}
+
+// Converts the batched palette indices to native pixels at the write position, sending the buffer out if it fills up
+static bool qp_internal_pixel_run_appender_expand(qp_internal_pixel_output_state_t* state, qp_pixel_t* palette) {
+    painter_driver_t* driver = (painter_driver_t*)state->device;
+    if (state->batch_count == 0) {
+        return true;
+    }
+
+    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, state->batch_count, state->batch_indices)) {
+        return false;
+    }
+    state->pixel_write_pos += state->batch_count;
+    state->batch_count = 0;
+
+    // If we've hit the transmit limit, send out the entire buffer and reset the write position
+    if (state->pixel_write_pos == state->max_pixels) {
+        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+            return false;
+        }
+        state->pixel_write_pos = 0;
+    }
+    return true;
+}
+
+bool qp_internal_pixel_run_appender(qp_pixel_t* palette, uint8_t index, uint32_t count, void* cb_arg) {
+    qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
+    painter_driver_t*                 driver = (painter_driver_t*)state->device;
+
+    // Short runs are batched up, so the driver converts many pixels per append_pixels() call instead of one
+    if (count < QP_PIXFILL_MIN_RUN) {
+        while (count-- > 0) {
+            state->batch_indices[state->batch_count++] = index;
+            if (state->batch_count == QP_PIXEL_BATCH_SIZE || state->pixel_write_pos + state->batch_count == state->max_pixels) {
+                if (!qp_internal_pixel_run_appender_expand(state, palette)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Anything batched needs to be written before this run
+    if (!qp_internal_pixel_run_appender_expand(state, palette)) {
+        return false;
+    }
+
+    // Long runs go straight to drivers that can repeat a pixel themselves
+    if (driver->driver_vtable->pixfill) {
+        if (state->pixel_write_pos > 0) {
+            if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+                return false;
+            }
+            state->pixel_write_pos = 0;
+        }
+
+        uint32_t native_pixel = 0; // large enough for any native pixel format
+        if (!driver->driver_vtable->append_pixels(state->device, (uint8_t*)&native_pixel, palette, 0, 1, &index)) {
+            return false;
+        }
+        return driver->driver_vtable->pixfill(state->device, &native_pixel, count);
+    }
+
+    while (count > 0) {
+        uint32_t loop_pixels = QP_MIN(count, state->max_pixels - state->pixel_write_pos);
+        if (!qp_internal_fill_pixel_run(state->device, qp_internal_global_pixdata_buffer, palette, index, state->pixel_write_pos, loop_pixels)) {
+            return false;
+        }
+        state->pixel_write_pos += loop_pixels;
+        count -= loop_pixels;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->pixel_write_pos == state->max_pixels) {
+            if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+                return false;
+            }
+            state->pixel_write_pos = 0;
+        }
+    }
+
+    return true;
+}
+
+bool qp_internal_pixel_run_appender_flush(qp_internal_pixel_output_state_t* state) {
+    painter_driver_t* driver = (painter_driver_t*)state->device;
+    if (!qp_internal_pixel_run_appender_expand(state, qp_internal_global_pixel_lookup_table)) {
+        return false;
+    }
+    if (state->pixel_write_pos > 0) {
+        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+            return false;
+        }
+        state->pixel_write_pos = 0;
+    }
+    return true;
+}
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -165,7 +477,32 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     return true;
 }
 
-// Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
+bool qp_internal_byte_run_appender(uint8_t byteval, uint32_t count, void* cb_arg) {
+    qp_internal_byte_output_state_t* state  = (qp_internal_byte_output_state_t*)cb_arg;
+    painter_driver_t*                driver = (painter_driver_t*)state->device;
+
+    while (count > 0) {
+        uint32_t loop_bytes = QP_MIN(count, state->max_bytes - state->byte_write_pos);
+        if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos, byteval)) {
+            return false;
+        }
+        memset(&qp_internal_global_pixdata_buffer[state->byte_write_pos + 1], qp_internal_global_pixdata_buffer[state->byte_write_pos], loop_bytes - 1);
+        state->byte_write_pos += loop_bytes;
+        count -= loop_bytes;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->byte_write_pos == state->max_bytes) {
+            if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+                return false;
+            }
+            state->byte_write_pos = 0;
+        }
+    }
+
+    return true;
+}
+
+// Helper shared between image and font rendering -- uses either (qp_internal_decode_palette_runs + qp_internal_pixel_run_appender) or (qp_internal_send_byte_runs) to send data data to the display based on the asset's native-ness
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
     painter_driver_t* driver = (painter_driver_t*)device;
 
@@ -177,11 +514,9 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
         // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+        ret = qp_internal_decode_palette_runs(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_run_appender, &output_state);
         // Any leftovers need transmission as well.
-        if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
-        }
+        ret = ret && qp_internal_pixel_run_appender_flush(&output_state);
     }
 
     // Native pixel format
@@ -192,9 +527,13 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         // Set up the output state
         qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
 
-        // Stream the raw pixel data to the display
+        // Stream the raw pixel data to the display -- uncompressed data has no runs, so it's cheaper to copy byte by byte
         uint32_t byte_count = pixel_count * bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+        if (input_callback != qp_drawimage_byte_uncompressed_decoder) {
+            ret = qp_internal_send_byte_runs(device, byte_count, input_callback, input_state, qp_internal_byte_run_appender, &output_state);
+        } else {
+            ret = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+        }
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
             ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
@@ -204,6 +543,74 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
     return ret;
 }
 
+typedef struct qp_internal_buffer_output_state_t {
+    painter_device_t device;
+    uint8_t*         buffer;
+    uint32_t         write_pos;
+    uint8_t          batch_count; // number of batch_indices waiting to be written from write_pos onwards
+    uint8_t          batch_indices[QP_PIXEL_BATCH_SIZE];
+} qp_internal_buffer_output_state_t;
+
+// Converts the batched palette indices to native pixels at the write position
+static bool qp_internal_buffer_pixel_run_expand(qp_internal_buffer_output_state_t* state, qp_pixel_t* palette) {
+    painter_driver_t* driver = (painter_driver_t*)state->device;
+    if (state->batch_count > 0 && !driver->driver_vtable->append_pixels(state->device, state->buffer, palette, state->write_pos, state->batch_count, state->batch_indices)) {
+        return false;
+    }
+    state->write_pos += state->batch_count;
+    state->batch_count = 0;
+    return true;
+}
+
+static bool qp_internal_buffer_pixel_run_appender(qp_pixel_t* palette, uint8_t index, uint32_t count, void* cb_arg) {
+    qp_internal_buffer_output_state_t* state = (qp_internal_buffer_output_state_t*)cb_arg;
+
+    // Short runs are batched up, same as qp_internal_pixel_run_appender()
+    if (count < QP_PIXFILL_MIN_RUN) {
+        while (count-- > 0) {
+            state->batch_indices[state->batch_count++] = index;
+            if (state->batch_count == QP_PIXEL_BATCH_SIZE && !qp_internal_buffer_pixel_run_expand(state, palette)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (!qp_internal_buffer_pixel_run_expand(state, palette) || !qp_internal_fill_pixel_run(state->device, state->buffer, palette, index, state->write_pos, count)) {
+        return false;
+    }
+    state->write_pos += count;
+    return true;
+}
+
+static bool qp_internal_buffer_byte_run_appender(uint8_t byteval, uint32_t count, void* cb_arg) {
+    qp_internal_buffer_output_state_t* state  = (qp_internal_buffer_output_state_t*)cb_arg;
+    painter_driver_t*                  driver = (painter_driver_t*)state->device;
+    if (!driver->driver_vtable->append_pixdata(state->device, state->buffer, state->write_pos, byteval)) {
+        return false;
+    }
+    memset(&state->buffer[state->write_pos + 1], state->buffer[state->write_pos], count - 1);
+    state->write_pos += count;
+    return true;
+}
+
+// Same as qp_internal_appender(), but decodes all the pixels into the supplied buffer instead of streaming them to the display
+bool qp_internal_decode_to_buffer(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state, uint8_t* buffer) {
+    painter_driver_t*                 driver       = (painter_driver_t*)device;
+    qp_internal_buffer_output_state_t output_state = {.device = device, .buffer = buffer, .write_pos = 0};
+
+    if (bpp <= 8) {
+        return qp_internal_decode_palette_runs(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_buffer_pixel_run_appender, &output_state) && qp_internal_buffer_pixel_run_expand(&output_state, qp_internal_global_pixel_lookup_table);
+    }
+
+    if (bpp != driver->native_bits_per_pixel) {
+        qp_dprintf("Asset's bpp (%d) doesn't match the target display's native_bits_per_pixel (%d)\n", bpp, driver->native_bits_per_pixel);
+        return false;
+    }
+
+    return qp_internal_send_byte_runs(device, pixel_count * bpp / 8, input_callback, input_state, qp_internal_buffer_byte_run_appender, &output_state);
+}
+
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
     switch (compression) {
         case IMAGE_UNCOMPRESSED:
@@ -212,6 +619,12 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+#if QUANTUM_PAINTER_SUPPORTS_LZ
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.remain   = 0;
+            input_state->lz.distance = 0;
+            return qp_drawimage_byte_lz_decoder;
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ
         default:
             return NULL;
     }
@@ -22,9 +22,11 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 // Buffer used for transmitting native pixel data to the downstream device.
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
 
-// Static buffer to contain a generated color palette
-static bool                                       generated_palette = false;
-static int16_t                                    generated_steps   = -1;
+// Static buffer to contain a generated color palette, along with what it was generated from so it can be reused as-is
+static painter_device_t                           palette_device = NULL; // Device the palette was converted for, NULL if there's no usable palette
+static int16_t                                    palette_steps  = -1;
+static const qp_stream_t                         *palette_stream = NULL; // Asset the palette was loaded from, NULL if interpolated
+static int32_t                                    palette_offset = -1;
 __attribute__((__aligned__(4))) static qp_pixel_t interpolated_fg_hsv888;
 __attribute__((__aligned__(4))) static qp_pixel_t interpolated_bg_hsv888;
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
@@ -64,24 +66,61 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     }
 }
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// append_pixels implementation shared by RGB565 drivers, whose palette_convert leaves each entry's native pixel in .rgb565
+bool qp_internal_append_pixels_rgb565(uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    uint16_t *buf = (uint16_t *)target_buffer + pixel_offset;
+    uint32_t  i   = 0;
+
+    // Get onto a 32-bit boundary, then write two pixels per store
+    if (pixel_count > 0 && ((uintptr_t)buf & 2) != 0) {
+        buf[i] = palette[palette_indices[i]].rgb565;
+        ++i;
+    }
+    uint32_t *pair = (uint32_t *)&buf[i];
+    for (; i + 1 < pixel_count; i += 2) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        *pair++ = ((uint32_t)palette[palette_indices[i]].rgb565 << 16) | palette[palette_indices[i + 1]].rgb565;
+#else
+        *pair++ = palette[palette_indices[i]].rgb565 | ((uint32_t)palette[palette_indices[i + 1]].rgb565 << 16);
+#endif
+    }
+    if (i < pixel_count) {
+        buf[i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+// Resets the global palette so that it gets regenerated and converted on next use
 void qp_internal_invalidate_palette(void) {
-    generated_palette = false;
-    generated_steps   = -1;
+    palette_device = NULL;
+    palette_steps  = -1;
+    palette_stream = NULL;
+    palette_offset = -1;
 }
 
-// Interpolates between two colors to generate a palette
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
-    // Check if we need to generate a new palette -- if the input parameters match then assume the palette can stay unchanged.
-    // This may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() to reset.
-    if (generated_palette == true && generated_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
-        // We already have the correct palette, no point regenerating it.
+// Converts a freshly-generated palette to the device's native format, and remembers which device it now belongs to
+static bool qp_internal_convert_palette(painter_device_t device, int16_t steps) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
+        qp_dprintf("qp_internal_convert_palette: fail (could not convert pixels to native)\n");
+        qp_internal_invalidate_palette();
         return false;
     }
 
+    palette_device = device;
+    palette_steps  = steps;
+    return true;
+}
+
+// Interpolates between two colors to generate a palette, converted to the device's native format
+bool qp_internal_interpolate_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    // If the input parameters match then the palette is already converted, no point regenerating it.
+    if (palette_device == device && palette_stream == NULL && palette_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
+        return true;
+    }
+
     // Save the parameters so we know whether we can skip generation
-    generated_palette      = true;
-    generated_steps        = steps;
+    qp_internal_invalidate_palette();
     interpolated_fg_hsv888 = fg_hsv888;
     interpolated_bg_hsv888 = bg_hsv888;
 
@@ -104,20 +143,26 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
         qp_dprintf("qp_internal_interpolate_palette: %3d of %d -- H: %3d, S: %3d, V: %3d\n", (int)(i + 1), (int)steps, (int)qp_internal_global_pixel_lookup_table[i].hsv888.h, (int)qp_internal_global_pixel_lookup_table[i].hsv888.s, (int)qp_internal_global_pixel_lookup_table[i].hsv888.v);
     }
 
-    return true;
+    return qp_internal_convert_palette(device, steps);
 }
 
-// Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
-bool qp_internal_load_qgf_palette(qp_stream_t *stream, uint8_t bpp) {
+// Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset, converted to the device's native format. Expects the stream to be positioned at the start of the block header.
+bool qp_internal_load_qgf_palette(painter_device_t device, qp_stream_t *stream, uint8_t bpp) {
+    // BPP determines the number of palette entries, each entry is a HSV888 triplet.
+    const uint16_t palette_entries = 1u << bpp;
+    const int32_t  offset          = qp_stream_tell(stream);
+
+    // If it's the same block as last time, the palette is already converted -- skip over it
+    if (palette_device == device && palette_stream == stream && palette_offset == offset && palette_steps == palette_entries) {
+        return qp_stream_seek(stream, sizeof(qgf_palette_v1_t) + palette_entries * sizeof(qgf_palette_entry_v1_t), SEEK_CUR) == 0;
+    }
+
     qgf_palette_v1_t palette_descriptor;
     if (qp_stream_read(&palette_descriptor, sizeof(qgf_palette_v1_t), 1, stream) != 1) {
         qp_dprintf("Failed to read palette_descriptor, expected length was not %d\n", (int)sizeof(qgf_palette_v1_t));
         return false;
     }
 
-    // BPP determines the number of palette entries, each entry is a HSV888 triplet.
-    const uint16_t palette_entries = 1u << bpp;
-
     // Ensure we aren't reusing any palette
     qp_internal_invalidate_palette();
 
@@ -137,6 +182,11 @@ bool qp_internal_load_qgf_palette(qp_stream_t *stream, uint8_t bpp) {
         qp_dprintf("qp_internal_load_qgf_palette: %3d of %d -- H: %3d, S: %3d, V: %3d\n", (int)(i + 1), (int)palette_entries, (int)qp_internal_global_pixel_lookup_table[i].hsv888.h, (int)qp_internal_global_pixel_lookup_table[i].hsv888.s, (int)qp_internal_global_pixel_lookup_table[i].hsv888.v);
     }
 
+    if (!qp_internal_convert_palette(device, palette_entries)) {
+        return false;
+    }
+    palette_stream = stream;
+    palette_offset = offset;
     return true;
 }
 
@@ -24,6 +24,96 @@ typedef struct qgf_image_handle_t {
 
 static qgf_image_handle_t image_descriptors[QUANTUM_PAINTER_NUM_IMAGES] = {0};
 
+typedef struct qgf_frame_info_t {
+    painter_compression_t compression_scheme;
+    uint8_t               bpp;
+    bool                  has_palette;
+    bool                  is_panel_native;
+    bool                  is_delta;
+    uint16_t              left;
+    uint16_t              top;
+    uint16_t              right;
+    uint16_t              bottom;
+    uint16_t              delay;
+} qgf_frame_info_t;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Animation frame cache
+
+#if QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+
+typedef struct qp_frame_cache_entry_t {
+    painter_device_t       device; // NULL if the entry is unused
+    painter_image_handle_t image;
+    uint16_t               frame_number;
+    qp_pixel_t             fg_hsv888;
+    qp_pixel_t             bg_hsv888;
+    qgf_frame_info_t       frame_info;
+    uint32_t               offset;
+    uint32_t               length;
+    uint32_t               age;
+} qp_frame_cache_entry_t;
+
+static qp_frame_cache_entry_t frame_cache_entries[QUANTUM_PAINTER_ANIMATION_CACHE_ENTRIES] = {0};
+static uint32_t               frame_cache_write_pos                                         = 0;
+static uint32_t               frame_cache_age                                               = 0;
+
+__attribute__((__aligned__(4))) static uint8_t frame_cache_buffer[QUANTUM_PAINTER_ANIMATION_CACHE_SIZE];
+
+static inline bool qp_frame_cache_same_color(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+static qp_frame_cache_entry_t *qp_frame_cache_find(painter_device_t device, painter_image_handle_t image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_ANIMATION_CACHE_ENTRIES; ++i) {
+        qp_frame_cache_entry_t *entry = &frame_cache_entries[i];
+        if (entry->device == device && entry->image == image && entry->frame_number == frame_number && qp_frame_cache_same_color(entry->fg_hsv888, fg_hsv888) && qp_frame_cache_same_color(entry->bg_hsv888, bg_hsv888)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Reserves space for a frame, evicting whichever older frames were stored there. The buffer is used as a ring, so a
+// looping animation that doesn't fit entirely keeps the most recently shown frames.
+static qp_frame_cache_entry_t *qp_frame_cache_alloc(uint32_t length) {
+    if (length == 0 || length > QUANTUM_PAINTER_ANIMATION_CACHE_SIZE) {
+        return NULL;
+    }
+
+    if (frame_cache_write_pos + length > QUANTUM_PAINTER_ANIMATION_CACHE_SIZE) {
+        frame_cache_write_pos = 0;
+    }
+
+    qp_frame_cache_entry_t *slot = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_ANIMATION_CACHE_ENTRIES; ++i) {
+        qp_frame_cache_entry_t *entry = &frame_cache_entries[i];
+        if (entry->device && entry->offset < frame_cache_write_pos + length && frame_cache_write_pos < entry->offset + entry->length) {
+            entry->device = NULL;
+        }
+        if (!slot || (slot->device && (!entry->device || entry->age < slot->age))) {
+            slot = entry;
+        }
+    }
+
+    slot->device = NULL;
+    slot->offset = frame_cache_write_pos;
+    slot->length = length;
+    slot->age    = frame_cache_age++;
+    frame_cache_write_pos += length;
+    return slot;
+}
+
+static void qp_frame_cache_evict_image(painter_image_handle_t image) {
+    for (int i = 0; i < QUANTUM_PAINTER_ANIMATION_CACHE_ENTRIES; ++i) {
+        if (frame_cache_entries[i].image == image) {
+            frame_cache_entries[i].device = NULL;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load image from stream
 
@@ -97,6 +187,10 @@ bool qp_close_image(painter_image_handle_t image) {
 
     // Free up this image for use elsewhere.
     qgf_image->validate_ok = false;
+    qp_internal_invalidate_palette(); // any palette loaded from this image can't be reused by whatever's loaded next
+#if QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+    qp_frame_cache_evict_image(image);
+#endif // QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
     qp_stream_close(&qgf_image->stream);
     return true;
 }
@@ -111,22 +205,7 @@ bool qp_drawimage(painter_device_t device, uint16_t x, uint16_t y, painter_image
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_drawimage_recolor
 
-typedef struct qgf_frame_info_t {
-    painter_compression_t compression_scheme;
-    uint8_t               bpp;
-    bool                  has_palette;
-    bool                  is_panel_native;
-    bool                  is_delta;
-    uint16_t              left;
-    uint16_t              top;
-    uint16_t              right;
-    uint16_t              bottom;
-    uint16_t              delay;
-} qgf_frame_info_t;
-
 static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info) {
-    painter_driver_t *driver = (painter_driver_t *)device;
-
     // Drop out if we can't actually place the data we read out anywhere
     if (!info) {
         qp_dprintf("Failed to prepare stream for read, output info buffer unavailable\n");
@@ -148,9 +227,6 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Ensure we aren't reusing any palette
-    qp_internal_invalidate_palette();
-
     if (!qp_internal_bpp_capable(info->bpp)) {
         qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
         qp_comms_stop(device);
@@ -158,27 +234,15 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     }
 
     // Handle palette if needed
-    const uint16_t palette_entries  = 1u << info->bpp;
-    bool           needs_pixconvert = false;
     if (info->has_palette) {
         // Load the palette from the stream
-        if (!qp_internal_load_qgf_palette((qp_stream_t *)&qgf_image->stream, info->bpp)) {
+        if (!qp_internal_load_qgf_palette(device, (qp_stream_t *)&qgf_image->stream, info->bpp)) {
+            qp_dprintf("qp_drawimage_recolor: fail (could not set up palette)\n");
             return false;
         }
-
-        needs_pixconvert = true;
-    } else {
-        if (info->bpp <= 8) {
-            // Interpolate from fg/bg
-            needs_pixconvert = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
-        }
-    }
-
-    if (needs_pixconvert) {
-        // Convert the palette to native format
-        if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
-            qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
-            qp_comms_stop(device);
+    } else if (info->bpp <= 8) {
+        // Interpolate from fg/bg
+        if (!qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, 1u << info->bpp)) {
             return false;
         }
     }
@@ -208,7 +272,7 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     return true;
 }
 
-static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, bool use_cache) {
     qp_dprintf("qp_drawimage_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -222,8 +286,18 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    bool is_cached = false;
+#if QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+    // Frames already in the cache skip reading and decoding entirely
+    qp_frame_cache_entry_t *cache_entry = use_cache ? qp_frame_cache_find(device, image, frame_number, fg_hsv888, bg_hsv888) : NULL;
+    if (cache_entry) {
+        *frame_info = cache_entry->frame_info;
+        is_cached   = true;
+    }
+#endif // QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+
     // Read the frame info
-    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
+    if (!is_cached && !qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
         return false;
     }
@@ -254,6 +328,16 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    bool ret;
+#if QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+    if (is_cached) {
+        ret = driver->driver_vtable->pixdata(device, &frame_cache_buffer[cache_entry->offset], pixel_count);
+        qp_dprintf("qp_drawimage_recolor: %s (cached)\n", ret ? "ok" : "fail");
+        qp_comms_stop(device);
+        return ret;
+    }
+#endif // QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+
     // Set up the input state
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
@@ -263,8 +347,28 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+#if QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+    // Decode into the cache if there's room, then send from there
+    cache_entry = use_cache ? qp_frame_cache_alloc((pixel_count * driver->native_bits_per_pixel + 7) / 8) : NULL;
+    if (cache_entry) {
+        uint8_t *buffer = &frame_cache_buffer[cache_entry->offset];
+        ret             = qp_internal_decode_to_buffer(device, frame_info->bpp, pixel_count, input_callback, &input_state, buffer) && driver->driver_vtable->pixdata(device, buffer, pixel_count);
+        if (ret) {
+            cache_entry->device       = device;
+            cache_entry->image        = image;
+            cache_entry->frame_number = frame_number;
+            cache_entry->fg_hsv888    = fg_hsv888;
+            cache_entry->bg_hsv888    = bg_hsv888;
+            cache_entry->frame_info   = *frame_info;
+        }
+        qp_dprintf("qp_drawimage_recolor: %s (now cached)\n", ret ? "ok" : "fail");
+        qp_comms_stop(device);
+        return ret;
+    }
+#endif // QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+
     // Decode and stream pixels
-    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -275,7 +379,7 @@ bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, paint
     qgf_frame_info_t frame_info = {0};
     qp_pixel_t       fg_hsv888  = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t       bg_hsv888  = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
+    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888, false);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -305,7 +409,7 @@ static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATION
 static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
     qgf_frame_info_t frame_info = {0};
     qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
-    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
+    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888, true);
     if (ret) {
         ++state->frame_number;
         if (state->frame_number >= state->image->frame_count) {
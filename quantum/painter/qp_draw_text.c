@@ -36,6 +36,148 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+typedef struct qp_glyph_cache_entry_t {
+    qff_font_handle_t *font; // NULL if the entry is unused
+    painter_device_t   device;
+    uint32_t           code_point;
+    qp_pixel_t         fg_hsv888;
+    qp_pixel_t         bg_hsv888;
+    uint32_t           offset;
+    uint32_t           length;
+    uint32_t           last_used;
+} qp_glyph_cache_entry_t;
+
+// Glyph widths, indexed by code point, so that measuring text doesn't need to seek through the font
+typedef struct qp_glyph_metrics_t {
+    qff_font_handle_t *font; // NULL if the entry is unused
+    uint32_t           code_point;
+    uint8_t            width;
+} qp_glyph_metrics_t;
+
+static qp_glyph_cache_entry_t glyph_cache_entries[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static qp_glyph_metrics_t     glyph_metrics[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES]       = {0};
+static uint32_t               glyph_cache_clock                                        = 0;
+
+__attribute__((__aligned__(4))) static uint8_t glyph_cache_buffer[QUANTUM_PAINTER_GLYPH_CACHE_SIZE];
+
+static inline bool qp_glyph_cache_same_color(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+static bool qp_glyph_metrics_find(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+    qp_glyph_metrics_t *metrics = &glyph_metrics[code_point % QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES];
+    if (metrics->font != qff_font || metrics->code_point != code_point) {
+        return false;
+    }
+    *width = metrics->width;
+    return true;
+}
+
+static void qp_glyph_metrics_store(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width) {
+    qp_glyph_metrics_t *metrics = &glyph_metrics[code_point % QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES];
+    metrics->font               = qff_font;
+    metrics->code_point         = code_point;
+    metrics->width              = width;
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(painter_device_t device, qff_font_handle_t *qff_font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache_entries[i];
+        if (entry->font == qff_font && entry->device == device && entry->code_point == code_point && qp_glyph_cache_same_color(entry->fg_hsv888, fg_hsv888) && qp_glyph_cache_same_color(entry->bg_hsv888, bg_hsv888)) {
+            entry->last_used = ++glyph_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_least_recently_used(void) {
+    qp_glyph_cache_entry_t *lru = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache_entries[i];
+        if (entry->font && (!lru || entry->last_used < lru->last_used)) {
+            lru = entry;
+        }
+    }
+    return lru;
+}
+
+// Finds a free gap in the buffer, trying the start of the buffer and the end of each stored glyph
+static bool qp_glyph_cache_find_gap(uint32_t length, uint32_t *offset) {
+    for (int i = -1; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        uint32_t start = 0;
+        if (i >= 0) {
+            if (!glyph_cache_entries[i].font) {
+                continue;
+            }
+            start = glyph_cache_entries[i].offset + glyph_cache_entries[i].length;
+        }
+        if (start + length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+            continue;
+        }
+
+        bool fits = true;
+        for (int j = 0; j < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES && fits; ++j) {
+            qp_glyph_cache_entry_t *entry = &glyph_cache_entries[j];
+            fits                          = !entry->font || entry->offset >= start + length || start >= entry->offset + entry->length;
+        }
+        if (fits) {
+            *offset = start;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Reserves space for a glyph, evicting the least recently drawn glyphs until it fits. The entry is only keyed once
+// the glyph has been decoded successfully.
+static qp_glyph_cache_entry_t *qp_glyph_cache_alloc(uint32_t length) {
+    // Keep every glyph 4-byte aligned, so drivers can read native pixels wider than a byte straight from the buffer
+    length = (length + 3) & ~3u;
+    if (length == 0 || length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        return NULL;
+    }
+
+    uint32_t offset;
+    while (!qp_glyph_cache_find_gap(length, &offset)) {
+        qp_glyph_cache_least_recently_used()->font = NULL;
+    }
+
+    qp_glyph_cache_entry_t *slot = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES && !slot; ++i) {
+        if (!glyph_cache_entries[i].font) {
+            slot = &glyph_cache_entries[i];
+        }
+    }
+    if (!slot) {
+        slot = qp_glyph_cache_least_recently_used();
+    }
+
+    slot->font      = NULL;
+    slot->offset    = offset;
+    slot->length    = length;
+    slot->last_used = ++glyph_cache_clock;
+    return slot;
+}
+
+static void qp_glyph_cache_evict_font(qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache_entries[i].font == qff_font) {
+            glyph_cache_entries[i].font = NULL;
+        }
+        if (glyph_metrics[i].font == qff_font) {
+            glyph_metrics[i].font = NULL;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -151,6 +293,13 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    qp_glyph_cache_evict_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+    // Any palette loaded from this font can't be reused by whatever's loaded next
+    qp_internal_invalidate_palette();
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -165,8 +314,6 @@ typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_po
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
-    painter_driver_t *driver = (painter_driver_t *)device;
-
     // Drop out if we can't actually place the data we read out anywhere
     if (!data_offset) {
         qp_dprintf("Failed to prepare stream for read, output info buffer unavailable\n");
@@ -183,29 +330,19 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     }
 
     // Handle palette if needed
-    const uint16_t palette_entries  = 1u << qff_font->bpp;
-    bool           needs_pixconvert = false;
     if (qff_font->has_palette) {
         // If this font has a palette, we need to read it out and set up the pixel lookup table
         qp_stream_setpos(&qff_font->stream, offset);
-        if (!qp_internal_load_qgf_palette(&qff_font->stream, qff_font->bpp)) {
+        if (!qp_internal_load_qgf_palette(device, &qff_font->stream, qff_font->bpp)) {
             return false;
         }
 
         // Skip this block, as far as offset calculations go
-        offset += sizeof(qgf_palette_v1_t) + (palette_entries * 3);
-        needs_pixconvert = true;
+        offset += sizeof(qgf_palette_v1_t) + ((1u << qff_font->bpp) * 3);
     } else {
         // Interpolate from fg/bg
-        int16_t palette_entries = 1 << qff_font->bpp;
-        needs_pixconvert        = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
-    }
-
-    if (needs_pixconvert) {
-        // Convert the palette to native format
-        if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
+        if (!qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, 1 << qff_font->bpp)) {
             qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
-            qp_comms_stop(device);
             return false;
         }
     }
@@ -303,10 +440,21 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
         }
 
         uint8_t width;
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+        // Known glyphs skip the seek, the drawing callback positions the stream itself if it needs the glyph data
+        if (!qp_glyph_metrics_find(qff_font, code_point, &width)) {
+            if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+                qp_dprintf("Failed to prepare glyph for rendering.\n");
+                return false;
+            }
+            qp_glyph_metrics_store(qff_font, code_point, width);
+        }
+#else
         if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
             return false;
         }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
 
         if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
@@ -345,15 +493,55 @@ typedef struct code_point_iter_drawglyph_state_t {
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
+    qp_pixel_t                        fg_hsv888;
+    qp_pixel_t                        bg_hsv888;
 } code_point_iter_drawglyph_state_t;
 
 // Codepoint handler callback: drawing
 static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
-    code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
-    painter_driver_t *                 driver = (painter_driver_t *)state->device;
+    code_point_iter_drawglyph_state_t *state       = (code_point_iter_drawglyph_state_t *)cb_arg;
+    painter_driver_t *                 driver      = (painter_driver_t *)state->device;
+    uint32_t                           pixel_count = ((uint32_t)width) * height;
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    qp_glyph_cache_entry_t *cache_entry = qp_glyph_cache_find(state->device, qff_font, code_point, state->fg_hsv888, state->bg_hsv888);
+    if (cache_entry) {
+        driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
+        state->xpos += width;
+        return driver->driver_vtable->pixdata(state->device, &glyph_cache_buffer[cache_entry->offset], pixel_count);
+    }
+
+    // The width may have come from the metrics cache, in which case the stream isn't positioned at the glyph yet
+    if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        return false;
+    }
+
+    cache_entry = qp_glyph_cache_alloc((pixel_count * driver->native_bits_per_pixel + 7) / 8);
+    if (cache_entry) {
+        qp_internal_prepare_input_state(state->input_state, qff_font->compression_scheme);
+
+        uint8_t *buffer = &glyph_cache_buffer[cache_entry->offset];
+        if (!qp_internal_decode_to_buffer(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state, buffer)) {
+            return false;
+        }
+
+        driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
+        state->xpos += width;
+        if (!driver->driver_vtable->pixdata(state->device, buffer, pixel_count)) {
+            return false;
+        }
+
+        cache_entry->font       = qff_font;
+        cache_entry->device     = state->device;
+        cache_entry->code_point = code_point;
+        cache_entry->fg_hsv888  = state->fg_hsv888;
+        cache_entry->bg_hsv888  = state->bg_hsv888;
+        return true;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
 
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
-    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
+    // Reset the input state's decoder -- the stream should already be correctly positioned by qp_iterate_code_points()
+    qp_internal_prepare_input_state(state->input_state, qff_font->compression_scheme);
 
     // Reset the output state
     state->output_state->pixel_write_pos = 0;
@@ -365,7 +553,6 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     state->xpos += width;
 
     // Decode the pixel data for the glyph, and stream it
-    uint32_t pixel_count = ((uint32_t)width) * height;
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
@@ -373,16 +560,34 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
 // Quantum Painter External API: qp_textwidth
 
 int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
+    int16_t width;
+    return qp_textmeasure(font, str, &width, NULL) ? width : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_textmeasure
+
+bool qp_textmeasure(painter_font_handle_t font, const char *str, int16_t *width, int16_t *height) {
     qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
     if (!qff_font || !qff_font->validate_ok) {
-        qp_dprintf("qp_textwidth: fail (invalid font)\n");
+        qp_dprintf("qp_textmeasure: fail (invalid font)\n");
         return false;
     }
 
     // Create the codepoint iterator state
     code_point_iter_calcwidth_state_t state = {.width = 0};
-    // Iterate each codepoint, return the calculated width if successful.
-    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
+    // Iterate each codepoint, calculating the overall width
+    if (!qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state)) {
+        return false;
+    }
+
+    if (width) {
+        *width = state.width;
+    }
+    if (height) {
+        *height = qff_font->base.line_height;
+    }
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,6 +633,9 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     // Set up the pixel output state
     qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+
     // Set up the codepoint iteration state
     code_point_iter_drawglyph_state_t state = {// Common
                                                .device = device,
@@ -437,11 +645,12 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
                                                .input_callback = input_callback,
                                                .input_state    = &input_state,
                                                // Output
-                                               .output_state = &output_state};
+                                               .output_state = &output_state,
+                                               // Colors
+                                               .fg_hsv888 = fg_hsv888,
+                                               .bg_hsv888 = bg_hsv888};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
+    uint32_t data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
@@ -17,6 +17,7 @@ typedef bool (*painter_driver_pixdata_func)(painter_device_t device, const void
 typedef bool (*painter_driver_convert_palette_func)(painter_device_t device, int16_t palette_size, qp_pixel_t *palette);
 typedef bool (*painter_driver_append_pixels)(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices);
 typedef bool (*painter_driver_append_pixdata)(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte);
+typedef bool (*painter_driver_pixfill_func)(painter_device_t device, const void *native_pixel, uint32_t native_pixel_count);
 
 // Driver vtable definition
 typedef struct painter_driver_vtable_t {
@@ -29,6 +30,7 @@ typedef struct painter_driver_vtable_t {
     painter_driver_convert_palette_func palette_convert;
     painter_driver_append_pixels        append_pixels;
     painter_driver_append_pixdata       append_pixdata;
+    painter_driver_pixfill_func         pixfill; // Optional, streams native_pixel_count copies of one native pixel
 } painter_driver_vtable_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
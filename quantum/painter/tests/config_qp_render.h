@@ -0,0 +1,15 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 1
+#define MATRIX_COLS 1
+
+#define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS 1
+#define QUANTUM_PAINTER_SUPPORTS_256_PALETTE 1
+#define QUANTUM_PAINTER_SUPPORTS_LZ 1
+#define QUANTUM_PAINTER_ANIMATION_CACHE_SIZE 16384
+
+// Same as the round GC9A01 panel the fingerpunch display code defaults to
+#define FP_QP_DISPLAY_WIDTH 240
+#define FP_QP_DISPLAY_HEIGHT 240
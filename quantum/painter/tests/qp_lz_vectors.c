@@ -0,0 +1,478 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated by lib/python/qmk/tests/test_qmk_painter.py -- do not edit
+
+#include "qp_lz_vectors.h"
+
+static const uint8_t long_matches_data[] = {
+    0x2D, 0xF3, 0xF2, 0xDB, 0xD7, 0xE6, 0x1A, 0x63, 0x15, 0x8F, 0xB8, 0xDA, 0x26, 0x03, 0x6A, 0xD0,
+    0xDB, 0xE0, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x11, 0x8D,
+    0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1,
+    0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A,
+    0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D,
+    0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1,
+    0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A,
+    0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D,
+    0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1,
+    0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A,
+    0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D,
+    0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1,
+    0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A,
+    0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D,
+    0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1,
+    0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A,
+    0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x95, 0x5A, 0x25, 0xE6, 0x46,
+    0xB4, 0xC1, 0x89, 0xC8, 0x89, 0x17, 0xB0, 0xF9, 0x44, 0x51, 0xE4, 0x83, 0xF9, 0xF2, 0x87, 0x64,
+    0x73, 0x78, 0x77, 0x79, 0x89, 0x24, 0x09, 0x64, 0xCA, 0x7E, 0xE9, 0x38, 0xC5, 0x4C, 0x5F, 0x02,
+    0x7B, 0x08, 0x42, 0xA4, 0xFE, 0x8C, 0x0A, 0x65, 0xA5, 0x20, 0x6F, 0x41, 0x88, 0x81, 0xBB, 0x63,
+    0x44, 0x0B, 0xB9, 0xBA, 0x71, 0x40, 0x8C, 0x19, 0xBA, 0x8E, 0x4A, 0x43, 0x20, 0x9F, 0xEC, 0xDA,
+    0xFF, 0x55, 0x9D, 0xCB, 0xE9, 0xDD, 0x43, 0xBE, 0x88, 0x28, 0x25, 0xEB, 0x98, 0xBD, 0x82, 0xC2,
+    0x71, 0xF2, 0x00, 0xC2, 0x45, 0x34, 0xA6, 0xF6, 0x44, 0xAD, 0xF9, 0x52, 0x41, 0x3B, 0x09, 0xB6,
+    0x05, 0xA7, 0x59, 0xD1, 0x3F, 0xFC, 0x30, 0xA5, 0x11, 0xE7, 0x2F, 0x29, 0x16, 0x5B, 0xDF, 0xF2,
+    0xDF, 0xB5, 0x8A, 0xEB, 0x6F, 0x61, 0x4D, 0x40, 0x0F, 0x33, 0x71, 0xD2, 0x27, 0xB3, 0xA4, 0x20,
+    0xC9, 0xDC, 0xE2, 0x51, 0x0B, 0x69, 0xB3, 0x48, 0x01, 0x10, 0x44, 0xBA, 0x68, 0xA1, 0x27, 0x8B,
+    0xB8, 0xDD, 0x65, 0xD4, 0x6E, 0x82, 0x9B, 0x4B, 0x2A, 0x70, 0x71, 0x52, 0x5B, 0x0D, 0xE5, 0x9F,
+    0xFC, 0xCD, 0xB7, 0x14, 0x11, 0x17, 0x08, 0x5D, 0x59, 0x71, 0x17, 0x16, 0xF5, 0x0E, 0x38, 0x95,
+};
+
+static const uint8_t long_matches_lz[] = {
+    0x12, 0x2D, 0xF3, 0xF2, 0xDB, 0xD7, 0xE6, 0x1A, 0x63, 0x15, 0x8F, 0xB8, 0xDA, 0x26, 0x03, 0x6A,
+    0xD0, 0xDB, 0xE0, 0x5A, 0xFC, 0x00, 0xFF, 0xFF, 0x9B, 0x05, 0x11, 0x8D, 0x69, 0x3A, 0xD5, 0xE1,
+    0xFC, 0x05, 0xC8, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x0A, 0x7F, 0x0E, 0x95, 0x5A, 0x25, 0xE6, 0x46,
+    0xB4, 0xC1, 0x89, 0xC8, 0x89, 0x17, 0xB0, 0xF9, 0x44, 0x51, 0xE4, 0x83, 0xF9, 0xF2, 0x87, 0x64,
+    0x73, 0x78, 0x77, 0x79, 0x89, 0x24, 0x09, 0x64, 0xCA, 0x7E, 0xE9, 0x38, 0xC5, 0x4C, 0x5F, 0x02,
+    0x7B, 0x08, 0x42, 0xA4, 0xFE, 0x8C, 0x0A, 0x65, 0xA5, 0x20, 0x6F, 0x41, 0x88, 0x81, 0xBB, 0x63,
+    0x44, 0x0B, 0xB9, 0xBA, 0x71, 0x40, 0x8C, 0x19, 0xBA, 0x8E, 0x4A, 0x43, 0x20, 0x9F, 0xEC, 0xDA,
+    0xFF, 0x55, 0x9D, 0xCB, 0xE9, 0xDD, 0x43, 0xBE, 0x88, 0x28, 0x25, 0xEB, 0x98, 0xBD, 0x82, 0xC2,
+    0x71, 0xF2, 0x00, 0xC2, 0x45, 0x34, 0xA6, 0xF6, 0x44, 0xAD, 0xF9, 0x52, 0x41, 0x3B, 0x09, 0xB6,
+    0x05, 0xA7, 0x59, 0xD1, 0x3F, 0xFC, 0x30, 0xA5, 0x11, 0xE7, 0x2F, 0x29, 0x16, 0x5B, 0xDF, 0xF2,
+    0xDF, 0xB5, 0x8A, 0xEB, 0x6F, 0x61, 0x4D, 0x40, 0x0F, 0x33, 0x35, 0x71, 0xD2, 0x27, 0xB3, 0xA4,
+    0x20, 0xC9, 0xDC, 0xE2, 0x51, 0x0B, 0x69, 0xB3, 0x48, 0x01, 0x10, 0x44, 0xBA, 0x68, 0xA1, 0x27,
+    0x8B, 0xB8, 0xDD, 0x65, 0xD4, 0x6E, 0x82, 0x9B, 0x4B, 0x2A, 0x70, 0x71, 0x52, 0x5B, 0x0D, 0xE5,
+    0x9F, 0xFC, 0xCD, 0xB7, 0x14, 0x11, 0x17, 0x08, 0x5D, 0x59, 0x71, 0x17, 0x16, 0xF5, 0x0E, 0x38,
+    0x95,
+};
+
+static const uint8_t window_distance_data[] = {
+    0x15, 0x6E, 0x05, 0x88, 0x5C, 0xFB, 0x7B, 0x61, 0x56, 0xCC, 0x3B, 0xE1, 0x1C, 0x1E, 0x8C, 0x8F,
+    0xD7, 0xCC, 0x9E, 0x64, 0x9D, 0xA6, 0x09, 0x53, 0x55, 0x6A, 0xA1, 0xAF, 0x7E, 0x0A, 0xA9, 0xF9,
+    0xD6, 0x3D, 0x97, 0xB0, 0x47, 0xD4, 0x20, 0x52, 0x7E, 0x2B, 0x38, 0x7E, 0x18, 0x55, 0x2F, 0xBF,
+    0x23, 0x64, 0xD2, 0x87, 0xF2, 0x25, 0xB1, 0x2B, 0x7F, 0x12, 0x04, 0xBE, 0x4C, 0xA2, 0xDE, 0xB6,
+    0x91, 0x13, 0xA3, 0x13, 0xF5, 0x96, 0xE2, 0x05, 0x15, 0xC1, 0xA6, 0x5D, 0xA4, 0x03, 0xE2, 0xA3,
+    0x3A, 0x4A, 0xD9, 0x5A, 0x0E, 0x2C, 0xB9, 0xC1, 0x57, 0x58, 0x08, 0xEB, 0xEF, 0x77, 0x5A, 0xB6,
+    0x3C, 0x5B, 0x39, 0xA7, 0x3F, 0xEB, 0xE0, 0xAD, 0x2C, 0xB1, 0xC3, 0x50, 0x89, 0x9C, 0x17, 0x97,
+    0x83, 0xD5, 0x90, 0x33, 0x17, 0x79, 0xB4, 0xCD, 0x05, 0x6E, 0x16, 0x6B, 0xF9, 0x81, 0xD5, 0x3B,
+    0x64, 0x6A, 0xAF, 0x4B, 0x5B, 0xE9, 0x4F, 0x49, 0xCA, 0xE1, 0x7B, 0x9F, 0xAB, 0xA6, 0x41, 0x12,
+    0x68, 0x12, 0xEC, 0x3D, 0x26, 0xA0, 0xD3, 0x25, 0x1D, 0x9C, 0x82, 0xBD, 0x06, 0xBC, 0xE3, 0x2C,
+    0x6A, 0xDC, 0x3C, 0xF6, 0xFB, 0x40, 0x57, 0x2E, 0x51, 0xE0, 0x12, 0x10, 0x7D, 0x71, 0xF1, 0xAB,
+    0xD2, 0xC4, 0x78, 0x98, 0x4E, 0x1E, 0x02, 0x49, 0x5D, 0x45, 0xEA, 0xF7, 0x77, 0xC9, 0x90, 0x84,
+    0x36, 0xE7, 0x75, 0x64, 0x19, 0x92, 0xAB, 0xE2, 0x90, 0x41, 0xD9, 0x33, 0x9B, 0x6C, 0xB1, 0x18,
+    0x42, 0x1E, 0xA0, 0xEB, 0x19, 0x5D, 0x09, 0xA8, 0x8A, 0xFE, 0x07, 0x3F, 0xA0, 0xD7, 0x6F, 0xDA,
+    0x21, 0x1C, 0xEE, 0x8C, 0xD0, 0x14, 0x4D, 0xA5, 0xB0, 0x19, 0xCD, 0x2A, 0x71, 0x9A, 0xEF, 0x7E,
+    0x0F, 0x05, 0x31, 0x40, 0xBB, 0x43, 0x45, 0x70, 0x7A, 0x0A, 0xDD, 0x94, 0x60, 0x65, 0x16, 0xD0,
+    0x92, 0xD3, 0x27, 0x47, 0xC9, 0x4A, 0xE2, 0x8B, 0x54, 0x9B, 0x50, 0x9A, 0x14, 0x01, 0x99, 0x5D,
+    0xD9, 0x71, 0xA4, 0x1C, 0xEA, 0xD9, 0xFE, 0x1D, 0xED, 0x64, 0xB1, 0xE4, 0xED, 0x37, 0x97, 0xA4,
+    0x13, 0x08, 0x53, 0xCC, 0x41, 0x81, 0x47, 0xDB, 0x51, 0xEF, 0x46, 0x58, 0xA3, 0x53, 0x67, 0xA3,
+    0x7B, 0xC1, 0x29, 0xBA, 0x11, 0x18, 0xBE, 0x0B, 0xDD, 0x7A, 0xAA, 0x37, 0x5F, 0x64, 0x0D, 0x4B,
+    0x3D, 0x86, 0xBC, 0x1D, 0xCA, 0xD1, 0x5E, 0xE8, 0x66, 0x00, 0xEB, 0xB1, 0xF8, 0x14, 0xFC, 0xFB,
+    0xE7, 0xFE, 0x3B, 0x19, 0x74, 0x3E, 0xC6, 0xAA, 0xAE, 0xF9, 0x07, 0xD9, 0x97, 0xA1, 0x99, 0x67,
+    0x17, 0xD7, 0x4C, 0x4C, 0xEF, 0x16, 0xC1, 0x1C, 0x0B, 0xA6, 0x73, 0x86, 0xBA, 0x7A, 0x9D, 0xF3,
+    0x89, 0xA9, 0x32, 0x62, 0xF1, 0xEC, 0x0A, 0x9D, 0x67, 0x54, 0xB1, 0x74, 0x94, 0x68, 0x8C, 0x97,
+    0xDD, 0x39, 0xD2, 0xA0, 0xE0, 0x1A, 0x79, 0xFB, 0x39, 0x5B, 0xC4, 0xE3, 0xC6, 0x0E, 0x13, 0x83,
+    0x02, 0xB0, 0xD6, 0x72, 0x49, 0xD6, 0x6F, 0x04, 0x2E, 0x84, 0xF4, 0xD9, 0x13, 0x7F, 0x6E, 0x88,
+    0x2D, 0x15, 0x69, 0x21, 0x27, 0x0F, 0x96, 0xD4, 0xF5, 0x91, 0x24, 0xA7, 0xE2, 0x50, 0xB7, 0xA6,
+    0x17, 0xCF, 0xC6, 0x9B, 0x52, 0x40, 0x5B, 0x20, 0x52, 0x55, 0x4B, 0x4C, 0x83, 0x8A, 0x69, 0x2A,
+    0xBA, 0x9A, 0xE0, 0x29, 0x1B, 0x15, 0x1B, 0xB5, 0x04, 0x4C, 0x52, 0x28, 0x8D, 0x7A, 0x6C, 0x0D,
+    0xE3, 0xB7, 0x8B, 0xD6, 0xC2, 0x0F, 0x56, 0x78, 0x6E, 0x7F, 0xF8, 0xCC, 0x06, 0x3D, 0xFC, 0xD7,
+    0x6B, 0xEC, 0x21, 0x79, 0x14, 0x6D, 0xA8, 0xA9, 0xDE, 0xE2, 0xD2, 0x87, 0x84, 0x9B, 0x1B, 0x8E,
+    0xCD, 0xC6, 0xB2, 0x82, 0x42, 0x31, 0x3E, 0x2A, 0x54, 0x72, 0x76, 0x7A, 0x8C, 0x70, 0xE5, 0x0E,
+    0xD3, 0x12, 0x3D, 0x94, 0xE9, 0xA8, 0x23, 0x2E, 0xDC, 0xFC, 0xC2, 0x69, 0xE9, 0x65, 0x11, 0x97,
+    0x61, 0xBE, 0x68, 0xA4, 0x38, 0xCA, 0x5C, 0xDF, 0x51, 0x75, 0xB7, 0x6A, 0x16, 0x78, 0x7D, 0x1D,
+    0xE0, 0xF2, 0x92, 0xB6, 0x99, 0x8D, 0x5B, 0xA5, 0x90, 0xB5, 0x57, 0x0F, 0x4A, 0x9D, 0x21, 0xFF,
+    0x7D, 0xC4, 0xEE, 0x73, 0xE9, 0x37, 0x72, 0x3D, 0x4B, 0x8F, 0xEA, 0xE9, 0x81, 0x64, 0x1F, 0x78,
+    0x90, 0x63, 0x9B, 0xFC, 0x30, 0x78, 0xDB, 0x5B, 0xA6, 0xC7, 0x66, 0xEB, 0xCD, 0x3A, 0xD7, 0x63,
+    0x3D, 0xDC, 0x6D, 0x75, 0x9A, 0xE0, 0x49, 0xEF, 0x9F, 0x5D, 0x2A, 0x08, 0xE8, 0x7C, 0xA9, 0x48,
+    0x72, 0xC2, 0x35, 0x2D, 0x53, 0x21, 0x02, 0xE9, 0x59, 0xFC, 0x93, 0xD1, 0xE7, 0xE8, 0xE6, 0x26,
+    0x51, 0x01, 0xAE, 0x6A, 0xD7, 0x26, 0x09, 0x47, 0xD6, 0x4C, 0x90, 0x4E, 0xC8, 0xD4, 0x36, 0x99,
+    0x10, 0x77, 0x93, 0x57, 0xAD, 0xC4, 0x58, 0xBE, 0x59, 0x92, 0xF0, 0x39, 0x4F, 0xA3, 0x24, 0x12,
+    0x65, 0x89, 0xCC, 0xBF, 0xF3, 0xB4, 0xBD, 0x11, 0x01, 0x85, 0x20, 0x3C, 0x7A, 0xEF, 0xA8, 0xC7,
+    0xC5, 0xC2, 0x3F, 0xDD, 0xAA, 0x2C, 0xD2, 0x2A, 0xFA, 0x57, 0xE8, 0x24, 0xB9, 0x71, 0x06, 0x11,
+    0xF5, 0xD1, 0xB3, 0xCB, 0x46, 0x7F, 0x24, 0xCA, 0xFB, 0xCD, 0xA4, 0x0B, 0x5E, 0x7E, 0x8F, 0x45,
+    0xB8, 0x37, 0xEE, 0x00, 0x50, 0xD2, 0x3E, 0x50, 0x27, 0x4C, 0x47, 0xAA, 0xAA, 0xF1, 0x40, 0x47,
+    0x4F, 0x40, 0xB6, 0x48, 0x82, 0x45, 0xF0, 0xF1, 0x0A, 0x05, 0x2D, 0xE7, 0xF5, 0xE5, 0x46, 0x43,
+    0x49, 0x87, 0xF0, 0xBF, 0xC6, 0x7D, 0x52, 0x9C, 0xC4, 0xBA, 0xCA, 0x3C, 0x66, 0x6A, 0xC3, 0x8F,
+    0xAB, 0xB5, 0x50, 0x73, 0x96, 0x87, 0x39, 0x8E, 0x26, 0x2B, 0x7A, 0x90, 0xC9, 0x07, 0x91, 0x7D,
+    0xB6, 0x70, 0x20, 0xCF, 0x3C, 0xDC, 0xDB, 0x23, 0xE9, 0x17, 0xFE, 0x55, 0x57, 0x4F, 0x46, 0xE5,
+    0x95, 0xBB, 0x1F, 0xB0, 0x16, 0xF7, 0x22, 0x79, 0x7F, 0xEB, 0xFA, 0xCC, 0x93, 0x71, 0x56, 0xA1,
+    0x20, 0xDE, 0xAD, 0xDB, 0x74, 0xD9, 0x61, 0xE6, 0x0D, 0x56, 0x4F, 0xB8, 0xE5, 0xC0, 0xB8, 0xEC,
+    0x90, 0x95, 0x84, 0x57, 0x8F, 0x4D, 0x7B, 0x95, 0x44, 0x43, 0xA3, 0x4E, 0xBB, 0x01, 0xE2, 0xAB,
+    0xC9, 0x38, 0xDC, 0xEB, 0x63, 0x04, 0xFA, 0x0E, 0x62, 0x5D, 0x29, 0x50, 0xE2, 0xC5, 0xFC, 0xEB,
+    0x9F, 0x44, 0x58, 0x8C, 0xCE, 0x56, 0xC3, 0xA2, 0xDD, 0xDB, 0xD6, 0xE2, 0xB6, 0xE1, 0xF7, 0x84,
+    0x2E, 0xFE, 0xA6, 0x75, 0xB7, 0xE3, 0x1E, 0xFC, 0xBA, 0xC7, 0x26, 0x6F, 0x8F, 0xD6, 0xD7, 0xF0,
+    0xBF, 0x11, 0x91, 0x19, 0x16, 0x81, 0x7B, 0xF7, 0x55, 0x21, 0xE6, 0xF9, 0x0A, 0x77, 0xC2, 0x34,
+    0x04, 0x4A, 0xFB, 0x7A, 0x41, 0x7D, 0xCE, 0x04, 0xC9, 0xEE, 0x81, 0x85, 0x0F, 0xAD, 0xE5, 0xD4,
+    0xA1, 0x1D, 0xD5, 0x30, 0x8A, 0xDD, 0x99, 0x93, 0xC7, 0x2E, 0xB0, 0xB3, 0xBE, 0xF1, 0x66, 0xC0,
+    0x19, 0x8F, 0x21, 0xBB, 0x86, 0x23, 0x7B, 0x43, 0x22, 0xEA, 0xE8, 0x82, 0x14, 0x37, 0x7B, 0xC7,
+    0xA8, 0x6F, 0x36, 0x13, 0x38, 0x16, 0x6D, 0x4B, 0xC5, 0x4E, 0xEB, 0xEB, 0xB9, 0x5A, 0x6D, 0xD6,
+    0x39, 0x5E, 0x45, 0x8E, 0xDA, 0x64, 0xF4, 0xB1, 0x7A, 0x2F, 0xF5, 0x6B, 0x87, 0xD9, 0xD7, 0xE9,
+    0x86, 0x39, 0x3F, 0xF3, 0x18, 0x42, 0xD8, 0xC0, 0x61, 0x0C, 0x09, 0x19, 0x57, 0xEE, 0x54, 0xFB,
+    0xE2, 0x00, 0xD4, 0xCD, 0x9F, 0xC8, 0x65, 0x5E, 0xE6, 0x3E, 0x3F, 0x75, 0x15, 0x62, 0x44, 0xCC,
+    0xF0, 0x25, 0x4E, 0xBA, 0x5B, 0xFB, 0x7B, 0x57, 0x0E, 0x09, 0xC8, 0xC3, 0xFD, 0x2E, 0x76, 0xC3,
+    0x15, 0x6E, 0x05, 0x88, 0x5C, 0xFB, 0x7B, 0x61, 0x56, 0xCC, 0x3B, 0xE1, 0x1C, 0x1E, 0x8C, 0x8F,
+    0xD7, 0xCC, 0x9E, 0x64, 0x9D, 0xA6, 0x09, 0x53, 0x55, 0x6A, 0xA1, 0xAF, 0x7E, 0x0A, 0xA9, 0xF9,
+    0xD6, 0x3D, 0x97, 0xB0, 0x47, 0xD4, 0x20, 0x52, 0x7E, 0x2B, 0x38, 0x7E, 0x18, 0x55, 0x2F, 0xBF,
+    0x23, 0x64, 0xD2, 0x87, 0xF2, 0x25, 0xB1, 0x2B, 0x7F, 0x12, 0x04, 0xBE, 0x4C, 0xA2, 0xDE, 0xB6,
+    0x91, 0x13, 0xA3, 0x13, 0xF5, 0x96, 0xE2, 0x05, 0x15, 0xC1, 0xA6, 0x5D, 0xA4, 0x03, 0xE2, 0xA3,
+    0x3A, 0x4A, 0xD9, 0x5A, 0x0E, 0x2C, 0xB9, 0xC1, 0x57, 0x58, 0x08, 0xEB, 0xEF, 0x77, 0x5A, 0xB6,
+    0x3C, 0x5B, 0x39, 0xA7, 0x3F, 0xEB, 0xE0, 0xAD, 0x2C, 0xB1, 0xC3, 0x50, 0x89, 0x9C, 0x17, 0x97,
+    0x83, 0xD5, 0x90, 0x33, 0x17, 0x79, 0xB4, 0xCD, 0x05, 0x6E, 0x16, 0x6B, 0xF9, 0x81, 0xD5, 0x3B,
+    0x64, 0x6A, 0xAF, 0x4B, 0x5B, 0xE9, 0x4F, 0x49, 0xCA, 0xE1, 0x7B, 0x9F, 0xAB, 0xA6, 0x41, 0x12,
+    0x68, 0x12, 0xEC, 0x3D, 0x26, 0xA0, 0xD3, 0x25, 0x1D, 0x9C, 0x82, 0xBD, 0x06, 0xBC, 0xE3, 0x2C,
+    0x6A, 0xDC, 0x3C, 0xF6, 0xFB, 0x40, 0x57, 0x2E, 0x51, 0xE0, 0x12, 0x10, 0x7D, 0x71, 0xF1, 0xAB,
+    0xD2, 0xC4, 0x78, 0x98, 0x4E, 0x1E, 0x02, 0x49, 0x5D, 0x45, 0xEA, 0xF7, 0x77, 0xC9, 0x90, 0x84,
+    0x36, 0xE7, 0x75, 0x64, 0x19, 0x92, 0xAB, 0xE2, 0x90, 0x41, 0xD9, 0x33, 0x9B, 0x6C, 0xB1, 0x18,
+    0x42, 0x1E, 0xA0, 0xEB, 0x19, 0x5D, 0x09, 0xA8, 0x8A, 0xFE, 0x07, 0x3F, 0xA0, 0xD7, 0x6F, 0xDA,
+    0x21, 0x1C, 0xEE, 0x8C, 0xD0, 0x14, 0x4D, 0xA5, 0xB0, 0x19, 0xCD, 0x2A, 0x71, 0x9A, 0xEF, 0x7E,
+    0x0F, 0x05, 0x31, 0x40, 0xBB, 0x43, 0x45, 0x70, 0x7A, 0x0A, 0xDD, 0x94, 0x60, 0x65, 0x16, 0xD0,
+    0x92, 0xD3, 0x27, 0x47, 0xC9, 0x4A, 0xE2, 0x8B, 0x54, 0x9B, 0x50, 0x9A, 0x14, 0x01, 0x99, 0x5D,
+    0xD9, 0x71, 0xA4, 0x1C, 0xEA, 0xD9, 0xFE, 0x1D, 0xED, 0x64, 0xB1, 0xE4, 0xED, 0x37, 0x97, 0xA4,
+    0x13, 0x08, 0x53, 0xCC, 0x41, 0x81, 0x47, 0xDB, 0x51, 0xEF, 0x46, 0x58, 0xA3, 0x53, 0x67, 0xA3,
+    0x7B, 0xC1, 0x29, 0xBA, 0x11, 0x18, 0xBE, 0x0B, 0xDD, 0x7A, 0xAA, 0x37, 0x5F, 0x64, 0x0D, 0x4B,
+    0x3D, 0x86, 0xBC, 0x1D, 0xCA, 0xD1, 0x5E, 0xE8, 0x66, 0x00, 0xEB, 0xB1, 0xF8, 0x14, 0xFC, 0xFB,
+    0xE7, 0xFE, 0x3B, 0x19, 0x74, 0x3E, 0xC6, 0xAA, 0xAE, 0xF9, 0x07, 0xD9, 0x97, 0xA1, 0x99, 0x67,
+    0x17, 0xD7, 0x4C, 0x4C, 0xEF, 0x16, 0xC1, 0x1C, 0x0B, 0xA6, 0x73, 0x86, 0xBA, 0x7A, 0x9D, 0xF3,
+    0x89, 0xA9, 0x32, 0x62, 0xF1, 0xEC, 0x0A, 0x9D, 0x67, 0x54, 0xB1, 0x74, 0x94, 0x68, 0x8C, 0x97,
+    0xDD, 0x39, 0xD2, 0xA0, 0xE0, 0x1A, 0x79, 0xFB, 0x39, 0x5B, 0xC4, 0xE3, 0xC6, 0x0E, 0x13, 0x83,
+    0x02, 0xB0, 0xD6, 0x72, 0x49, 0xD6, 0x6F, 0x04, 0x2E, 0x84, 0xF4, 0xD9, 0x13, 0x7F, 0x6E, 0x88,
+};
+
+static const uint8_t window_distance_lz[] = {
+    0x7F, 0x15, 0x6E, 0x05, 0x88, 0x5C, 0xFB, 0x7B, 0x61, 0x56, 0xCC, 0x3B, 0xE1, 0x1C, 0x1E, 0x8C,
+    0x8F, 0xD7, 0xCC, 0x9E, 0x64, 0x9D, 0xA6, 0x09, 0x53, 0x55, 0x6A, 0xA1, 0xAF, 0x7E, 0x0A, 0xA9,
+    0xF9, 0xD6, 0x3D, 0x97, 0xB0, 0x47, 0xD4, 0x20, 0x52, 0x7E, 0x2B, 0x38, 0x7E, 0x18, 0x55, 0x2F,
+    0xBF, 0x23, 0x64, 0xD2, 0x87, 0xF2, 0x25, 0xB1, 0x2B, 0x7F, 0x12, 0x04, 0xBE, 0x4C, 0xA2, 0xDE,
+    0xB6, 0x91, 0x13, 0xA3, 0x13, 0xF5, 0x96, 0xE2, 0x05, 0x15, 0xC1, 0xA6, 0x5D, 0xA4, 0x03, 0xE2,
+    0xA3, 0x3A, 0x4A, 0xD9, 0x5A, 0x0E, 0x2C, 0xB9, 0xC1, 0x57, 0x58, 0x08, 0xEB, 0xEF, 0x77, 0x5A,
+    0xB6, 0x3C, 0x5B, 0x39, 0xA7, 0x3F, 0xEB, 0xE0, 0xAD, 0x2C, 0xB1, 0xC3, 0x50, 0x89, 0x9C, 0x17,
+    0x97, 0x83, 0xD5, 0x90, 0x33, 0x17, 0x79, 0xB4, 0xCD, 0x05, 0x6E, 0x16, 0x6B, 0xF9, 0x81, 0xD5,
+    0x3B, 0x7F, 0x64, 0x6A, 0xAF, 0x4B, 0x5B, 0xE9, 0x4F, 0x49, 0xCA, 0xE1, 0x7B, 0x9F, 0xAB, 0xA6,
+    0x41, 0x12, 0x68, 0x12, 0xEC, 0x3D, 0x26, 0xA0, 0xD3, 0x25, 0x1D, 0x9C, 0x82, 0xBD, 0x06, 0xBC,
+    0xE3, 0x2C, 0x6A, 0xDC, 0x3C, 0xF6, 0xFB, 0x40, 0x57, 0x2E, 0x51, 0xE0, 0x12, 0x10, 0x7D, 0x71,
+    0xF1, 0xAB, 0xD2, 0xC4, 0x78, 0x98, 0x4E, 0x1E, 0x02, 0x49, 0x5D, 0x45, 0xEA, 0xF7, 0x77, 0xC9,
+    0x90, 0x84, 0x36, 0xE7, 0x75, 0x64, 0x19, 0x92, 0xAB, 0xE2, 0x90, 0x41, 0xD9, 0x33, 0x9B, 0x6C,
+    0xB1, 0x18, 0x42, 0x1E, 0xA0, 0xEB, 0x19, 0x5D, 0x09, 0xA8, 0x8A, 0xFE, 0x07, 0x3F, 0xA0, 0xD7,
+    0x6F, 0xDA, 0x21, 0x1C, 0xEE, 0x8C, 0xD0, 0x14, 0x4D, 0xA5, 0xB0, 0x19, 0xCD, 0x2A, 0x71, 0x9A,
+    0xEF, 0x7E, 0x0F, 0x05, 0x31, 0x40, 0xBB, 0x43, 0x45, 0x70, 0x7A, 0x0A, 0xDD, 0x94, 0x60, 0x65,
+    0x16, 0xD0, 0x7F, 0x92, 0xD3, 0x27, 0x47, 0xC9, 0x4A, 0xE2, 0x8B, 0x54, 0x9B, 0x50, 0x9A, 0x14,
+    0x01, 0x99, 0x5D, 0xD9, 0x71, 0xA4, 0x1C, 0xEA, 0xD9, 0xFE, 0x1D, 0xED, 0x64, 0xB1, 0xE4, 0xED,
+    0x37, 0x97, 0xA4, 0x13, 0x08, 0x53, 0xCC, 0x41, 0x81, 0x47, 0xDB, 0x51, 0xEF, 0x46, 0x58, 0xA3,
+    0x53, 0x67, 0xA3, 0x7B, 0xC1, 0x29, 0xBA, 0x11, 0x18, 0xBE, 0x0B, 0xDD, 0x7A, 0xAA, 0x37, 0x5F,
+    0x64, 0x0D, 0x4B, 0x3D, 0x86, 0xBC, 0x1D, 0xCA, 0xD1, 0x5E, 0xE8, 0x66, 0x00, 0xEB, 0xB1, 0xF8,
+    0x14, 0xFC, 0xFB, 0xE7, 0xFE, 0x3B, 0x19, 0x74, 0x3E, 0xC6, 0xAA, 0xAE, 0xF9, 0x07, 0xD9, 0x97,
+    0xA1, 0x99, 0x67, 0x17, 0xD7, 0x4C, 0x4C, 0xEF, 0x16, 0xC1, 0x1C, 0x0B, 0xA6, 0x73, 0x86, 0xBA,
+    0x7A, 0x9D, 0xF3, 0x89, 0xA9, 0x32, 0x62, 0xF1, 0xEC, 0x0A, 0x9D, 0x67, 0x54, 0xB1, 0x74, 0x94,
+    0x68, 0x8C, 0x97, 0x7F, 0xDD, 0x39, 0xD2, 0xA0, 0xE0, 0x1A, 0x79, 0xFB, 0x39, 0x5B, 0xC4, 0xE3,
+    0xC6, 0x0E, 0x13, 0x83, 0x02, 0xB0, 0xD6, 0x72, 0x49, 0xD6, 0x6F, 0x04, 0x2E, 0x84, 0xF4, 0xD9,
+    0x13, 0x7F, 0x6E, 0x88, 0x2D, 0x15, 0x69, 0x21, 0x27, 0x0F, 0x96, 0xD4, 0xF5, 0x91, 0x24, 0xA7,
+    0xE2, 0x50, 0xB7, 0xA6, 0x17, 0xCF, 0xC6, 0x9B, 0x52, 0x40, 0x5B, 0x20, 0x52, 0x55, 0x4B, 0x4C,
+    0x83, 0x8A, 0x69, 0x2A, 0xBA, 0x9A, 0xE0, 0x29, 0x1B, 0x15, 0x1B, 0xB5, 0x04, 0x4C, 0x52, 0x28,
+    0x8D, 0x7A, 0x6C, 0x0D, 0xE3, 0xB7, 0x8B, 0xD6, 0xC2, 0x0F, 0x56, 0x78, 0x6E, 0x7F, 0xF8, 0xCC,
+    0x06, 0x3D, 0xFC, 0xD7, 0x6B, 0xEC, 0x21, 0x79, 0x14, 0x6D, 0xA8, 0xA9, 0xDE, 0xE2, 0xD2, 0x87,
+    0x84, 0x9B, 0x1B, 0x8E, 0xCD, 0xC6, 0xB2, 0x82, 0x42, 0x31, 0x3E, 0x2A, 0x54, 0x72, 0x76, 0x7A,
+    0x8C, 0x70, 0xE5, 0x0E, 0x7F, 0xD3, 0x12, 0x3D, 0x94, 0xE9, 0xA8, 0x23, 0x2E, 0xDC, 0xFC, 0xC2,
+    0x69, 0xE9, 0x65, 0x11, 0x97, 0x61, 0xBE, 0x68, 0xA4, 0x38, 0xCA, 0x5C, 0xDF, 0x51, 0x75, 0xB7,
+    0x6A, 0x16, 0x78, 0x7D, 0x1D, 0xE0, 0xF2, 0x92, 0xB6, 0x99, 0x8D, 0x5B, 0xA5, 0x90, 0xB5, 0x57,
+    0x0F, 0x4A, 0x9D, 0x21, 0xFF, 0x7D, 0xC4, 0xEE, 0x73, 0xE9, 0x37, 0x72, 0x3D, 0x4B, 0x8F, 0xEA,
+    0xE9, 0x81, 0x64, 0x1F, 0x78, 0x90, 0x63, 0x9B, 0xFC, 0x30, 0x78, 0xDB, 0x5B, 0xA6, 0xC7, 0x66,
+    0xEB, 0xCD, 0x3A, 0xD7, 0x63, 0x3D, 0xDC, 0x6D, 0x75, 0x9A, 0xE0, 0x49, 0xEF, 0x9F, 0x5D, 0x2A,
+    0x08, 0xE8, 0x7C, 0xA9, 0x48, 0x72, 0xC2, 0x35, 0x2D, 0x53, 0x21, 0x02, 0xE9, 0x59, 0xFC, 0x93,
+    0xD1, 0xE7, 0xE8, 0xE6, 0x26, 0x51, 0x01, 0xAE, 0x6A, 0xD7, 0x26, 0x09, 0x47, 0xD6, 0x4C, 0x90,
+    0x4E, 0xC8, 0xD4, 0x36, 0x99, 0x7F, 0x10, 0x77, 0x93, 0x57, 0xAD, 0xC4, 0x58, 0xBE, 0x59, 0x92,
+    0xF0, 0x39, 0x4F, 0xA3, 0x24, 0x12, 0x65, 0x89, 0xCC, 0xBF, 0xF3, 0xB4, 0xBD, 0x11, 0x01, 0x85,
+    0x20, 0x3C, 0x7A, 0xEF, 0xA8, 0xC7, 0xC5, 0xC2, 0x3F, 0xDD, 0xAA, 0x2C, 0xD2, 0x2A, 0xFA, 0x57,
+    0xE8, 0x24, 0xB9, 0x71, 0x06, 0x11, 0xF5, 0xD1, 0xB3, 0xCB, 0x46, 0x7F, 0x24, 0xCA, 0xFB, 0xCD,
+    0xA4, 0x0B, 0x5E, 0x7E, 0x8F, 0x45, 0xB8, 0x37, 0xEE, 0x00, 0x50, 0xD2, 0x3E, 0x50, 0x27, 0x4C,
+    0x47, 0xAA, 0xAA, 0xF1, 0x40, 0x47, 0x4F, 0x40, 0xB6, 0x48, 0x82, 0x45, 0xF0, 0xF1, 0x0A, 0x05,
+    0x2D, 0xE7, 0xF5, 0xE5, 0x46, 0x43, 0x49, 0x87, 0xF0, 0xBF, 0xC6, 0x7D, 0x52, 0x9C, 0xC4, 0xBA,
+    0xCA, 0x3C, 0x66, 0x6A, 0xC3, 0x8F, 0xAB, 0xB5, 0x50, 0x73, 0x96, 0x87, 0x39, 0x8E, 0x26, 0x2B,
+    0x7A, 0x90, 0xC9, 0x07, 0x91, 0x7D, 0x7F, 0xB6, 0x70, 0x20, 0xCF, 0x3C, 0xDC, 0xDB, 0x23, 0xE9,
+    0x17, 0xFE, 0x55, 0x57, 0x4F, 0x46, 0xE5, 0x95, 0xBB, 0x1F, 0xB0, 0x16, 0xF7, 0x22, 0x79, 0x7F,
+    0xEB, 0xFA, 0xCC, 0x93, 0x71, 0x56, 0xA1, 0x20, 0xDE, 0xAD, 0xDB, 0x74, 0xD9, 0x61, 0xE6, 0x0D,
+    0x56, 0x4F, 0xB8, 0xE5, 0xC0, 0xB8, 0xEC, 0x90, 0x95, 0x84, 0x57, 0x8F, 0x4D, 0x7B, 0x95, 0x44,
+    0x43, 0xA3, 0x4E, 0xBB, 0x01, 0xE2, 0xAB, 0xC9, 0x38, 0xDC, 0xEB, 0x63, 0x04, 0xFA, 0x0E, 0x62,
+    0x5D, 0x29, 0x50, 0xE2, 0xC5, 0xFC, 0xEB, 0x9F, 0x44, 0x58, 0x8C, 0xCE, 0x56, 0xC3, 0xA2, 0xDD,
+    0xDB, 0xD6, 0xE2, 0xB6, 0xE1, 0xF7, 0x84, 0x2E, 0xFE, 0xA6, 0x75, 0xB7, 0xE3, 0x1E, 0xFC, 0xBA,
+    0xC7, 0x26, 0x6F, 0x8F, 0xD6, 0xD7, 0xF0, 0xBF, 0x11, 0x91, 0x19, 0x16, 0x81, 0x7B, 0xF7, 0x55,
+    0x21, 0xE6, 0xF9, 0x0A, 0x77, 0xC2, 0x34, 0x7F, 0x04, 0x4A, 0xFB, 0x7A, 0x41, 0x7D, 0xCE, 0x04,
+    0xC9, 0xEE, 0x81, 0x85, 0x0F, 0xAD, 0xE5, 0xD4, 0xA1, 0x1D, 0xD5, 0x30, 0x8A, 0xDD, 0x99, 0x93,
+    0xC7, 0x2E, 0xB0, 0xB3, 0xBE, 0xF1, 0x66, 0xC0, 0x19, 0x8F, 0x21, 0xBB, 0x86, 0x23, 0x7B, 0x43,
+    0x22, 0xEA, 0xE8, 0x82, 0x14, 0x37, 0x7B, 0xC7, 0xA8, 0x6F, 0x36, 0x13, 0x38, 0x16, 0x6D, 0x4B,
+    0xC5, 0x4E, 0xEB, 0xEB, 0xB9, 0x5A, 0x6D, 0xD6, 0x39, 0x5E, 0x45, 0x8E, 0xDA, 0x64, 0xF4, 0xB1,
+    0x7A, 0x2F, 0xF5, 0x6B, 0x87, 0xD9, 0xD7, 0xE9, 0x86, 0x39, 0x3F, 0xF3, 0x18, 0x42, 0xD8, 0xC0,
+    0x61, 0x0C, 0x09, 0x19, 0x57, 0xEE, 0x54, 0xFB, 0xE2, 0x00, 0xD4, 0xCD, 0x9F, 0xC8, 0x65, 0x5E,
+    0xE6, 0x3E, 0x3F, 0x75, 0x15, 0x62, 0x44, 0xCC, 0xF0, 0x25, 0x4E, 0xBA, 0x5B, 0xFB, 0x7B, 0x57,
+    0x0E, 0x09, 0xC8, 0xC3, 0xFD, 0x2E, 0x76, 0xC3, 0xFF, 0xFF, 0xFF, 0x7F,
+};
+
+static const uint8_t ends_in_run_data[] = {
+    0x4C, 0x84, 0xE8, 0xC0, 0xAA, 0xFD, 0x13, 0x4A, 0x96, 0xDA, 0xDD, 0x5F, 0xD7, 0x4E, 0x46, 0x40,
+    0xD2, 0x87, 0x25, 0x05, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+};
+
+static const uint8_t ends_in_run_lz[] = {
+    0x14, 0x4C, 0x84, 0xE8, 0xC0, 0xAA, 0xFD, 0x13, 0x4A, 0x96, 0xDA, 0xDD, 0x5F, 0xD7, 0x4E, 0x46,
+    0x40, 0xD2, 0x87, 0x25, 0x05, 0xA5, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE,
+};
+
+static const uint8_t ends_in_match_data[] = {
+    0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30, 0xCE,
+    0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43, 0x17,
+    0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC, 0x5B,
+    0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2, 0xC2,
+    0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9, 0x33,
+    0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9, 0x0A,
+    0xCD, 0xA3, 0xBC, 0x18, 0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1,
+    0x00, 0x06, 0x30, 0xCE, 0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53,
+    0xBB, 0xBE, 0x43, 0x17, 0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48,
+    0x63, 0x6B, 0xAC, 0x5B, 0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01,
+    0x98, 0x91, 0xA2, 0xC2, 0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF,
+    0xCC, 0x0F, 0xE9, 0x33, 0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB,
+    0x70, 0x11, 0xB9, 0x0A, 0xCD, 0xA3, 0xBC, 0x18, 0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20,
+    0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30, 0xCE, 0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E,
+    0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43, 0x17, 0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0,
+    0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC, 0x5B, 0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F,
+    0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2, 0xC2, 0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD,
+    0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9, 0x33, 0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71,
+    0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9, 0x0A, 0xCD, 0xA3, 0xBC, 0x18, 0x3F, 0x83, 0xB6, 0xA0,
+    0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30, 0xCE, 0x28, 0x0E, 0x8A, 0x74,
+    0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43, 0x17, 0xF2, 0x19, 0x55, 0x21,
+    0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC, 0x5B, 0x23, 0xF5, 0xB5, 0x50,
+    0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2, 0xC2, 0x1A, 0x74, 0x60, 0x8B,
+    0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9, 0x33, 0xAA, 0xAE, 0x51, 0x19,
+    0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9, 0x0A, 0xCD, 0xA3, 0xBC, 0x18,
+    0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30, 0xCE,
+    0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43, 0x17,
+    0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC, 0x5B,
+    0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2, 0xC2,
+    0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9, 0x33,
+    0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9, 0x0A,
+    0xCD, 0xA3, 0xBC, 0x18, 0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1,
+    0x00, 0x06, 0x30, 0xCE, 0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53,
+    0xBB, 0xBE, 0x43, 0x17, 0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48,
+    0x63, 0x6B, 0xAC, 0x5B, 0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01,
+    0x98, 0x91, 0xA2, 0xC2, 0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF,
+    0xCC, 0x0F, 0xE9, 0x33, 0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB,
+    0x70, 0x11, 0xB9, 0x0A, 0xCD, 0xA3, 0xBC, 0x18, 0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20,
+    0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30, 0xCE, 0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E,
+    0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43, 0x17, 0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0,
+    0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC, 0x5B, 0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F,
+    0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2, 0xC2, 0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD,
+    0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9, 0x33, 0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71,
+    0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9, 0x0A, 0xCD, 0xA3, 0xBC, 0x18, 0x3F, 0x83, 0xB6, 0xA0,
+    0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30, 0xCE, 0x28, 0x0E, 0x8A, 0x74,
+    0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43, 0x17, 0xF2, 0x19, 0x55, 0x21,
+    0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC, 0x5B, 0x23, 0xF5, 0xB5, 0x50,
+    0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2, 0xC2, 0x1A, 0x74, 0x60, 0x8B,
+    0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9, 0x33, 0xAA, 0xAE, 0x51, 0x19,
+    0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9, 0x0A, 0xCD, 0xA3, 0xBC, 0x18,
+    0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30, 0xCE,
+    0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43, 0x17,
+    0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC, 0x5B,
+    0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2, 0xC2,
+    0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9, 0x33,
+    0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9, 0x0A,
+    0xCD, 0xA3, 0xBC, 0x18, 0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1,
+    0x00, 0x06, 0x30, 0xCE, 0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53,
+    0xBB, 0xBE, 0x43, 0x17, 0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48,
+    0x63, 0x6B, 0xAC, 0x5B, 0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01,
+    0x98, 0x91, 0xA2, 0xC2, 0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF,
+    0xCC, 0x0F, 0xE9, 0x33, 0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB,
+    0x70, 0x11, 0xB9, 0x0A, 0xCD, 0xA3, 0xBC, 0x18, 0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20,
+    0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30, 0xCE, 0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E,
+    0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43, 0x17, 0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0,
+    0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC, 0x5B, 0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F,
+    0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2, 0xC2, 0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD,
+    0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9, 0x33, 0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71,
+    0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9, 0x0A, 0xCD, 0xA3, 0xBC, 0x18, 0x3F, 0x83, 0xB6, 0xA0,
+    0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30, 0xCE, 0x28, 0x0E, 0x8A, 0x74,
+    0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43, 0x17, 0xF2, 0x19, 0x55, 0x21,
+    0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC, 0x5B, 0x23, 0xF5, 0xB5, 0x50,
+    0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2, 0xC2, 0x1A, 0x74, 0x60, 0x8B,
+    0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9, 0x33, 0xAA, 0xAE, 0x51, 0x19,
+    0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9, 0x0A, 0xCD, 0xA3, 0xBC, 0x18,
+};
+
+static const uint8_t ends_in_match_lz[] = {
+    0x63, 0x3F, 0x83, 0xB6, 0xA0, 0xC5, 0x61, 0x33, 0x20, 0x51, 0x67, 0x9E, 0xA1, 0x00, 0x06, 0x30,
+    0xCE, 0x28, 0x0E, 0x8A, 0x74, 0x4B, 0xE5, 0x98, 0x8E, 0x1D, 0x9F, 0xEE, 0x53, 0xBB, 0xBE, 0x43,
+    0x17, 0xF2, 0x19, 0x55, 0x21, 0x17, 0xDA, 0x28, 0xE0, 0x48, 0x64, 0x77, 0x48, 0x63, 0x6B, 0xAC,
+    0x5B, 0x23, 0xF5, 0xB5, 0x50, 0x74, 0x22, 0xFF, 0x4F, 0xBE, 0x04, 0x13, 0x01, 0x98, 0x91, 0xA2,
+    0xC2, 0x1A, 0x74, 0x60, 0x8B, 0x9E, 0x44, 0x08, 0xAD, 0xE9, 0x85, 0x9A, 0xBF, 0xCC, 0x0F, 0xE9,
+    0x33, 0xAA, 0xAE, 0x51, 0x19, 0x53, 0xA2, 0x0D, 0x71, 0x69, 0x6F, 0x69, 0xEB, 0x70, 0x11, 0xB9,
+    0x0A, 0xCD, 0xA3, 0xBC, 0x18, 0xFC, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E,
+};
+
+const qp_lz_vector_t qp_lz_vectors[] = {
+    {"long_matches", long_matches_data, 1440, long_matches_lz, sizeof(long_matches_lz)},
+    {"window_distance", window_distance_data, 1440, window_distance_lz, sizeof(window_distance_lz)},
+    {"ends_in_run", ends_in_run_data, 960, ends_in_run_lz, sizeof(ends_in_run_lz)},
+    {"ends_in_match", ends_in_match_data, 960, ends_in_match_lz, sizeof(ends_in_match_lz)},
+};
+
+const uint8_t qp_lz_vector_count = sizeof(qp_lz_vectors) / sizeof(qp_lz_vectors[0]);
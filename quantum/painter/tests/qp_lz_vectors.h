@@ -0,0 +1,17 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+
+// Data compressed by the LZ encoder in lib/python/qmk/painter.py
+typedef struct qp_lz_vector_t {
+    const char    *name;
+    const uint8_t *data;
+    uint32_t       decoded_length; // octets of data the image covers, which may stop part of the way through the stream
+    const uint8_t *lz;
+    uint32_t       lz_length;
+} qp_lz_vector_t;
+
+extern const qp_lz_vector_t qp_lz_vectors[];
+extern const uint8_t        qp_lz_vector_count;
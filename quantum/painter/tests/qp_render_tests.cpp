@@ -0,0 +1,664 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <functional>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+extern "C" {
+#include "qp_virtual.h"
+#include "qp.h"
+#include "qp_internal.h"
+#include "qff.h"
+#include "qp_surface_internal.h"
+#include "qp_lz_vectors.h"
+}
+
+extern "C" {
+void advance_time(uint32_t ms);
+void qp_internal_animation_tick(void);
+
+extern const uint32_t font_roboto18_length;
+extern const uint8_t  font_roboto18[];
+extern const uint8_t font_urbanist36[];
+extern const uint8_t gfx_lock_caps_ON[];
+extern const uint8_t gfx_lock_caps_OFF[];
+}
+
+/*
+ * Draws what the fingerpunch display code puts on screen against a virtual
+ * panel, and reports what each step costs. The following environment
+ * variables control a run:
+ *
+ *   QP_RENDER_ITERATIONS  Times to draw each step (default 50)
+ *   QP_RENDER_DUMP_DIR    Write the panel after each step as <dir>/<step>.ppm
+ */
+
+#define DEFAULT_ITERATIONS 50
+#define DUMP_SCALE 2
+
+#define PANEL_WIDTH FP_QP_DISPLAY_WIDTH
+#define PANEL_HEIGHT FP_QP_DISPLAY_HEIGHT
+
+static bool is_lit(RGB rgb) {
+    return rgb.r + rgb.g + rgb.b > 0;
+}
+
+// Reads back an area of a panel, for comparing draws at different positions or times
+static std::vector<uint32_t> capture(painter_device_t device, uint16_t left, uint16_t top, uint16_t width, uint16_t height) {
+    std::vector<uint32_t> pixels;
+    for (uint16_t y = top; y < top + height; ++y) {
+        for (uint16_t x = left; x < left + width; ++x) {
+            RGB rgb = qp_virtual_get_pixel(device, x, y);
+            pixels.push_back((uint32_t)rgb.r << 16 | rgb.g << 8 | rgb.b);
+        }
+    }
+    return pixels;
+}
+
+// RLE as compress_bytes_qmk_rle() in lib/python/qmk/painter.py writes it: repeated runs of up to 127 bytes, and
+// runs of up to 128 bytes stored as they are
+static std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    size_t               n = 0;
+    while (n < data.size()) {
+        size_t repeat = 1;
+        while (n + repeat < data.size() && repeat < 127 && data[n + repeat] == data[n]) {
+            ++repeat;
+        }
+        if (repeat > 1) {
+            out.push_back(repeat);
+            out.push_back(data[n]);
+            n += repeat;
+            continue;
+        }
+
+        size_t start = n;
+        while (n < data.size() && n - start < 128 && (n + 1 == data.size() || data[n + 1] != data[n])) {
+            ++n;
+        }
+        out.push_back(127 + (n - start));
+        out.insert(out.end(), data.begin() + start, data.begin() + n);
+    }
+    return out;
+}
+
+typedef struct qgf_test_frame_t {
+    qp_image_format_t     format;
+    painter_compression_t compression;
+    std::vector<uint8_t>  palette; // HSV triplets, for the palette formats
+    std::vector<uint8_t>  data;
+    uint16_t              delay;
+} qgf_test_frame_t;
+
+static void put_le(std::vector<uint8_t> &out, uint32_t value, uint8_t bytes) {
+    for (uint8_t i = 0; i < bytes; ++i) {
+        out.push_back((value >> (8 * i)) & 0xFF);
+    }
+}
+
+static void put_block_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length) {
+    out.push_back(type_id);
+    out.push_back(~type_id);
+    put_le(out, length, 3);
+}
+
+// Lays out a QGF image the way qmk painter-convert-graphics writes one
+static std::vector<uint8_t> make_qgf(uint16_t width, uint16_t height, const std::vector<qgf_test_frame_t> &frames) {
+    std::vector<uint8_t> out;
+    put_block_header(out, 0x00, 18);
+    put_le(out, 0x464751, 3);
+    put_le(out, 1, 1);
+    put_le(out, 0, 8); // file size, filled in below
+    put_le(out, width, 2);
+    put_le(out, height, 2);
+    put_le(out, frames.size(), 2);
+
+    size_t offsets = out.size() + 5;
+    put_block_header(out, 0x01, frames.size() * 4);
+    put_le(out, 0, frames.size() * 4);
+
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const qgf_test_frame_t &frame = frames[i];
+        for (uint8_t b = 0; b < 4; ++b) {
+            out[offsets + i * 4 + b] = (out.size() >> (8 * b)) & 0xFF;
+        }
+
+        put_block_header(out, 0x02, 6);
+        put_le(out, frame.format, 1);
+        put_le(out, 0, 1); // flags
+        put_le(out, frame.compression, 1);
+        put_le(out, 0, 1); // transparency index
+        put_le(out, frame.delay, 2);
+
+        if (!frame.palette.empty()) {
+            put_block_header(out, 0x03, frame.palette.size());
+            out.insert(out.end(), frame.palette.begin(), frame.palette.end());
+        }
+
+        put_block_header(out, 0x05, frame.data.size());
+        out.insert(out.end(), frame.data.begin(), frame.data.end());
+    }
+
+    uint32_t size = out.size();
+    for (uint8_t b = 0; b < 4; ++b) {
+        out[9 + b]  = (size >> (8 * b)) & 0xFF;
+        out[13 + b] = (~size >> (8 * b)) & 0xFF;
+    }
+    return out;
+}
+
+class QpRender : public ::testing::Test {
+   protected:
+    painter_device_t       panel;
+    painter_font_handle_t  roboto18;
+    painter_font_handle_t  urbanist36;
+    painter_image_handle_t caps_on;
+    painter_image_handle_t caps_off;
+
+    void SetUp() override {
+        qp_virtual_reset();
+        panel = qp_virtual_make_rgb565_device(PANEL_WIDTH, PANEL_HEIGHT);
+        ASSERT_NE(panel, nullptr);
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+
+        roboto18   = qp_load_font_mem(font_roboto18);
+        urbanist36 = qp_load_font_mem(font_urbanist36);
+        caps_on    = qp_load_image_mem(gfx_lock_caps_ON);
+        caps_off   = qp_load_image_mem(gfx_lock_caps_OFF);
+        ASSERT_NE(roboto18, nullptr);
+        ASSERT_NE(urbanist36, nullptr);
+        ASSERT_NE(caps_on, nullptr);
+        ASSERT_NE(caps_off, nullptr);
+
+        qp_virtual_clear_stats(panel);
+    }
+
+    void TearDown() override {
+        qp_close_font(roboto18);
+        qp_close_font(urbanist36);
+        qp_close_image(caps_on);
+        qp_close_image(caps_off);
+        qp_virtual_reset();
+    }
+
+    // Draws an image on a second panel of the same size, for comparison against the main one
+    painter_device_t draw_reference(const std::vector<uint8_t> &qgf, uint16_t x, uint16_t y) {
+        painter_device_t       reference = qp_virtual_make_rgb565_device(PANEL_WIDTH, PANEL_HEIGHT);
+        painter_image_handle_t image     = qp_load_image_mem(qgf.data());
+        EXPECT_TRUE(reference && qp_init(reference, QP_ROTATION_0));
+        EXPECT_NE(image, nullptr);
+        EXPECT_TRUE(qp_drawimage(reference, x, y, image));
+        qp_close_image(image);
+        return reference;
+    }
+
+    void expect_same_pixels(painter_device_t reference, const char *what, painter_device_t device = nullptr) {
+        for (uint16_t y = 0; y < PANEL_HEIGHT; ++y) {
+            for (uint16_t x = 0; x < PANEL_WIDTH; ++x) {
+                RGB expected = qp_virtual_get_pixel(reference, x, y);
+                RGB actual   = qp_virtual_get_pixel(device ? device : panel, x, y);
+                ASSERT_TRUE(actual.r == expected.r && actual.g == expected.g && actual.b == expected.b) << what << " at " << x << "," << y;
+            }
+        }
+    }
+
+    // Text centred on the panel, as fp_qp_display_text() places it with FP_QP_CENTER
+    bool draw_centered_text(painter_font_handle_t font, const char *text) {
+        int16_t width, height;
+        if (!qp_textmeasure(font, text, &width, &height)) {
+            return false;
+        }
+        return qp_drawtext(panel, (PANEL_WIDTH - width) / 2, (PANEL_HEIGHT - height) / 2, font, text) == width;
+    }
+};
+
+TEST_F(QpRender, StartupFillCoversPanel) {
+    // The startup fill from fp_post_init_qp()
+    ASSERT_TRUE(qp_rect(panel, 0, 0, PANEL_WIDTH, PANEL_HEIGHT, 0, 255, 255, true));
+
+    const uint16_t corners[][2] = {{0, 0}, {PANEL_WIDTH - 1, 0}, {0, PANEL_HEIGHT - 1}, {PANEL_WIDTH - 1, PANEL_HEIGHT - 1}};
+    for (auto &corner : corners) {
+        RGB rgb = qp_virtual_get_pixel(panel, corner[0], corner[1]);
+        EXPECT_EQ(rgb.r, 255) << corner[0] << "," << corner[1];
+        EXPECT_EQ(rgb.g, 0) << corner[0] << "," << corner[1];
+        EXPECT_EQ(rgb.b, 0) << corner[0] << "," << corner[1];
+    }
+
+    qp_virtual_stats_t stats;
+    qp_virtual_get_stats(panel, &stats);
+    EXPECT_EQ(stats.calls, 1);
+    EXPECT_GE(stats.pixels, PANEL_WIDTH * PANEL_HEIGHT);
+    EXPECT_EQ(stats.bytes, stats.pixels * 2);
+}
+
+TEST_F(QpRender, TextStaysInsideMeasuredBox) {
+    const char *text = "fingerpunch";
+    int16_t     width, height;
+    ASSERT_TRUE(qp_textmeasure(roboto18, text, &width, &height));
+    ASSERT_GT(width, 0);
+    ASSERT_GT(height, 0);
+
+    const uint16_t left = 20, top = 30;
+    ASSERT_EQ(qp_drawtext(panel, left, top, roboto18, text), width);
+
+    uint32_t lit = 0;
+    for (uint16_t y = 0; y < PANEL_HEIGHT; ++y) {
+        for (uint16_t x = 0; x < PANEL_WIDTH; ++x) {
+            if (!is_lit(qp_virtual_get_pixel(panel, x, y))) {
+                continue;
+            }
+            ASSERT_TRUE(x >= left && x < left + width && y >= top && y < top + height) << x << "," << y;
+            lit++;
+        }
+    }
+    EXPECT_GT(lit, 0);
+
+    qp_virtual_stats_t stats;
+    qp_virtual_get_stats(panel, &stats);
+    EXPECT_EQ(stats.calls, 1);
+    EXPECT_LE(stats.pixels, (uint32_t)width * height);
+}
+
+TEST_F(QpRender, IconLandsAtPosition) {
+    ASSERT_TRUE(qp_drawimage_recolor(panel, 100, 60, caps_on, 0, 0, 255, 0, 0, 0));
+
+    // Everything drawn lies within the 32x32 icon, and is sent exactly once
+    for (uint16_t y = 0; y < PANEL_HEIGHT; ++y) {
+        for (uint16_t x = 0; x < PANEL_WIDTH; ++x) {
+            if (x < 100 || x >= 100 + caps_on->width || y < 60 || y >= 60 + caps_on->height) {
+                ASSERT_FALSE(is_lit(qp_virtual_get_pixel(panel, x, y))) << x << "," << y;
+            }
+        }
+    }
+
+    qp_virtual_stats_t stats;
+    qp_virtual_get_stats(panel, &stats);
+    EXPECT_EQ(stats.calls, 1);
+    EXPECT_EQ(stats.viewports, 1);
+    EXPECT_EQ(stats.pixels, (uint32_t)caps_on->width * caps_on->height);
+    EXPECT_EQ(stats.bytes, stats.pixels * 2);
+}
+
+TEST_F(QpRender, TextMeasureMatchesDrawnWidth) {
+    const char *texts[] = {"fingerpunch", "Hello, World! 0123", "\u0104\u023D\u0242\u0248\u0263\u027B\u02A3", "a\u0104b\u023Dc"};
+    for (auto font : {roboto18, urbanist36}) {
+        for (auto text : texts) {
+            // Measured before, between and after draws, as the glyph cache keeps widths from each
+            int16_t measured[3], height;
+            ASSERT_TRUE(qp_textmeasure(font, text, &measured[0], &height)) << text;
+            EXPECT_EQ(height, font->line_height) << text;
+            EXPECT_EQ(qp_drawtext(panel, 4, 4, font, text), measured[0]) << text;
+            ASSERT_TRUE(qp_textmeasure(font, text, &measured[1], &height)) << text;
+            EXPECT_EQ(qp_drawtext(panel, 4, 4, font, text), measured[0]) << text;
+            ASSERT_TRUE(qp_textmeasure(font, text, &measured[2], &height)) << text;
+            EXPECT_GT(measured[0], 0) << text;
+            EXPECT_EQ(measured[1], measured[0]) << text;
+            EXPECT_EQ(measured[2], measured[0]) << text;
+        }
+    }
+}
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+TEST_F(QpRender, GlyphCacheMatchesUncached) {
+    // A copy of the font, so its glyph data can be changed behind the cache
+    std::vector<uint8_t>  font_data(font_roboto18, font_roboto18 + font_roboto18_length);
+    painter_font_handle_t font = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr);
+
+    const char *text = "fingerpunch \u0104\u023D finger";
+    int16_t     width, height;
+    ASSERT_TRUE(qp_textmeasure(font, text, &width, &height));
+
+    // Repeated glyphs come from the cache within the first draw, all of them on the second
+    ASSERT_EQ(qp_drawtext(panel, 0, 0, font, text), width);
+    std::vector<uint32_t> first = capture(panel, 0, 0, width, height);
+    ASSERT_EQ(qp_drawtext(panel, 0, 100, font, text), width);
+    EXPECT_EQ(capture(panel, 0, 100, width, height), first);
+
+    // Garbling the glyph data shows nothing is decoded any more
+    const uint16_t num_unicode_glyphs = font_data[offsetof(qff_font_descriptor_v1_t, num_unicode_glyphs)] | font_data[offsetof(qff_font_descriptor_v1_t, num_unicode_glyphs) + 1] << 8;
+    const size_t   glyph_data         = sizeof(qff_font_descriptor_v1_t) + sizeof(qff_ascii_glyph_table_v1_t) + sizeof(qff_unicode_glyph_table_v1_t) + num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t) + sizeof(qgf_data_v1_t);
+    for (size_t i = glyph_data; i < font_data.size(); ++i) {
+        font_data[i] = ~font_data[i];
+    }
+    ASSERT_EQ(qp_drawtext(panel, 0, 150, font, text), width);
+    EXPECT_EQ(capture(panel, 0, 150, width, height), first);
+
+    // Glyphs are cached per color, so these are drawn from the garbled data
+    ASSERT_EQ(qp_drawtext_recolor(panel, 0, 50, font, text, 0, 0, 255, 0, 0, 1), width);
+    EXPECT_NE(capture(panel, 0, 50, width, height), first);
+
+    // The large font doesn't fit in the cache, so glyphs get evicted part of the way through the text
+    ASSERT_TRUE(qp_textmeasure(urbanist36, text, &width, &height));
+    ASSERT_EQ(qp_drawtext(panel, 0, 0, urbanist36, text), width);
+    first = capture(panel, 0, 0, width, height);
+    ASSERT_EQ(qp_drawtext(panel, 0, 100, urbanist36, text), width);
+    EXPECT_EQ(capture(panel, 0, 100, width, height), first);
+
+    qp_close_font(font);
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+TEST_F(QpRender, MonoPanelPacksPixels) {
+    painter_device_t mono = qp_virtual_make_mono1bpp_device(128, 64);
+    ASSERT_NE(mono, nullptr);
+    ASSERT_TRUE(qp_init(mono, QP_ROTATION_0));
+    qp_virtual_clear_stats(mono);
+
+    ASSERT_GT(qp_drawtext(mono, 0, 0, roboto18, "fp"), 0);
+
+    uint32_t lit = 0;
+    for (uint16_t y = 0; y < 64; ++y) {
+        for (uint16_t x = 0; x < 128; ++x) {
+            RGB rgb = qp_virtual_get_pixel(mono, x, y);
+            ASSERT_TRUE(rgb.r == 0 || rgb.r == 255);
+            lit += is_lit(rgb);
+        }
+    }
+    EXPECT_GT(lit, 0);
+
+    qp_virtual_stats_t stats;
+    qp_virtual_get_stats(mono, &stats);
+    EXPECT_GT(stats.pixels, 0);
+    EXPECT_LE(stats.bytes, stats.pixels / 8 + stats.pixdata_calls);
+
+    // The panels count separately
+    qp_virtual_get_stats(panel, &stats);
+    EXPECT_EQ(stats.calls, 0);
+}
+
+TEST_F(QpRender, SurfaceSendsDirtyRegions) {
+    static uint8_t           buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+    surface_painter_device_t device_table[1] = {};
+    painter_device_t         surface         = qp_make_rgb565_surface_advanced(device_table, 1, PANEL_WIDTH, PANEL_HEIGHT, buffer);
+    surface_dirty_data_t    *dirty           = &device_table[0].dirty;
+    ASSERT_TRUE(surface && qp_init(surface, QP_ROTATION_0));
+
+    // The reference panel always gets the whole surface. Drawing clears the dirty regions, so they're put back for it.
+    painter_device_t reference = qp_virtual_make_rgb565_device(PANEL_WIDTH, PANEL_HEIGHT);
+    ASSERT_TRUE(reference && qp_init(reference, QP_ROTATION_0));
+    auto flush_both = [&] {
+        surface_dirty_data_t regions = *dirty;
+        bool                 ok      = qp_surface_draw(surface, panel, 0, 0, false);
+        EXPECT_FALSE(dirty->is_dirty);
+        *dirty = regions;
+        return ok && qp_surface_draw(surface, reference, 0, 0, true);
+    };
+
+    ASSERT_TRUE(qp_rect(surface, 0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, 170, 255, 60, true));
+    ASSERT_TRUE(flush_both());
+
+    struct rect_t {
+        uint16_t l, t, r, b;
+    };
+    struct frame_t {
+        std::vector<rect_t> rects;
+        uint8_t             num_regions;
+    };
+    const std::vector<frame_t> frames = {
+        {{{10, 10, 40, 30}, {150, 160, 200, 220}}, 2},                                         // disjoint
+        {{{10, 10, 40, 30}, {30, 20, 70, 50}, {60, 5, 90, 25}}, 1},                            // overlapping
+        {{{20, 100, 60, 140}, {180, 20, 230, 50}, {40, 120, 90, 170}, {120, 200, 130, 210}}, 3}, // both
+        {{{5, 5, 9, 9}, {60, 5, 64, 9}, {120, 5, 124, 9}, {180, 5, 184, 9}, {5, 200, 9, 204}, {200, 200, 204, 204}}, SURFACE_NUM_DIRTY_REGIONS}, // more than fit
+    };
+    uint8_t hue = 0;
+    for (size_t f = 0; f < frames.size(); ++f) {
+        for (auto &rect : frames[f].rects) {
+            ASSERT_TRUE(qp_rect(surface, rect.l, rect.t, rect.r, rect.b, hue += 40, 255, 255, true));
+        }
+
+        // Every drawn pixel is in exactly one region
+        ASSERT_TRUE(dirty->is_dirty);
+        ASSERT_EQ(dirty->num_regions, frames[f].num_regions) << "frame " << f;
+        uint32_t region_pixels = 0;
+        for (uint8_t i = 0; i < dirty->num_regions; ++i) {
+            const surface_dirty_rect_t &region = dirty->regions[i];
+            region_pixels += (uint32_t)(region.r - region.l + 1) * (region.b - region.t + 1);
+        }
+        for (auto &rect : frames[f].rects) {
+            for (uint16_t y = rect.t; y <= rect.b; ++y) {
+                for (uint16_t x = rect.l; x <= rect.r; ++x) {
+                    uint8_t covered = 0;
+                    for (uint8_t i = 0; i < dirty->num_regions; ++i) {
+                        const surface_dirty_rect_t &region = dirty->regions[i];
+                        covered += x >= region.l && x <= region.r && y >= region.t && y <= region.b;
+                    }
+                    ASSERT_EQ(covered, 1) << "frame " << f << " at " << x << "," << y;
+                }
+            }
+        }
+
+        // Only the regions go out, one viewport each, yet the panel ends up the same as a full flush
+        uint8_t num_regions = dirty->num_regions;
+        qp_virtual_clear_stats(panel);
+        ASSERT_TRUE(flush_both());
+
+        qp_virtual_stats_t stats;
+        qp_virtual_get_stats(panel, &stats);
+        EXPECT_EQ(stats.viewports, num_regions) << "frame " << f;
+        EXPECT_EQ(stats.pixels, region_pixels) << "frame " << f;
+        EXPECT_LT(stats.pixels, PANEL_WIDTH * PANEL_HEIGHT / 4) << "frame " << f;
+        expect_same_pixels(reference, "dirty regions");
+    }
+
+    // Nothing is sent while the surface is clean
+    qp_virtual_clear_stats(panel);
+    ASSERT_TRUE(qp_surface_draw(surface, panel, 0, 0, false));
+    qp_virtual_stats_t stats;
+    qp_virtual_get_stats(panel, &stats);
+    EXPECT_EQ(stats.pixels, 0);
+}
+
+TEST_F(QpRender, LzImagesMatchEncoder) {
+    for (uint8_t i = 0; i < qp_lz_vector_count; ++i) {
+        const qp_lz_vector_t &vector = qp_lz_vectors[i];
+        const uint16_t        height = vector.decoded_length / (PANEL_WIDTH * 2);
+        ASSERT_EQ(vector.decoded_length, PANEL_WIDTH * 2 * height) << vector.name;
+
+        // The same pixels, stored as they are
+        std::vector<uint8_t> raw(vector.data, vector.data + vector.decoded_length);
+        std::vector<uint8_t> lz(vector.lz, vector.lz + vector.lz_length);
+        std::vector<uint8_t> uncompressed_qgf = make_qgf(PANEL_WIDTH, height, {{RGB565_16BPP, IMAGE_UNCOMPRESSED, {}, raw, 0}});
+        std::vector<uint8_t> lz_qgf           = make_qgf(PANEL_WIDTH, height, {{RGB565_16BPP, IMAGE_COMPRESSED_LZ, {}, lz, 0}});
+
+        painter_device_t       reference = draw_reference(uncompressed_qgf, 0, 10);
+        painter_image_handle_t image = qp_load_image_mem(lz_qgf.data());
+        ASSERT_NE(image, nullptr) << vector.name;
+        ASSERT_TRUE(qp_drawimage(panel, 0, 10, image)) << vector.name;
+        expect_same_pixels(reference, vector.name);
+        qp_close_image(image);
+
+        // Only QP_VIRTUAL_NUM_DEVICES panels can exist at once, so start the next vector afresh
+        qp_virtual_reset();
+        panel = qp_virtual_make_rgb565_device(PANEL_WIDTH, PANEL_HEIGHT);
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+    }
+}
+
+TEST_F(QpRender, RleRunsMatchUncompressed) {
+    const uint16_t width = PANEL_WIDTH, height = 40, left = 0, top = 30;
+
+    // Runs far longer than the pixdata buffer, starting at odd offsets so they end part of the way through it,
+    // between stretches of data that doesn't repeat
+    uint32_t seed  = 1;
+    auto     noise = [&](std::vector<uint8_t> &data, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            seed = seed * 1103515245 + 12345;
+            data.push_back(seed >> 16);
+        }
+    };
+    auto fill = [&](size_t size, std::initializer_list<std::pair<uint8_t, size_t>> runs) {
+        std::vector<uint8_t> data;
+        while (data.size() < size) {
+            for (auto &run : runs) {
+                noise(data, 37);
+                data.insert(data.end(), run.second, run.first);
+            }
+        }
+        data.resize(size);
+        return data;
+    };
+
+    std::vector<uint8_t> palette;
+    for (uint8_t i = 0; i < 16; ++i) {
+        palette.insert(palette.end(), {(uint8_t)(i * 16), 255, (uint8_t)(255 - i * 8)});
+    }
+
+    struct rle_case_t {
+        const char      *name;
+        qgf_test_frame_t frame;
+    };
+    const rle_case_t cases[] = {
+        // Native pixels are repeated a byte at a time
+        {"rgb565", {RGB565_16BPP, IMAGE_COMPRESSED_RLE, {}, fill(width * height * 2, {{0x00, 1500}, {0xFF, QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 3 + 1}, {0x5A, 300}}), 0}},
+        // Repeats of the same index become one run, repeats of differing indices have to be split up
+        {"palette_4bpp", {PALETTE_4BPP, IMAGE_COMPRESSED_RLE, palette, fill(width * height / 2, {{0x33, 700}, {0x12, 600}, {0xEE, 2000}}), 0}},
+        {"grayscale_1bpp", {GRAYSCALE_1BPP, IMAGE_COMPRESSED_RLE, {}, fill(width * height / 8, {{0xFF, 130}, {0x00, 200}, {0x0F, 90}}), 0}},
+    };
+
+    for (auto &rle_case : cases) {
+        qgf_test_frame_t uncompressed = rle_case.frame;
+        uncompressed.compression      = IMAGE_UNCOMPRESSED;
+        qgf_test_frame_t compressed   = rle_case.frame;
+        compressed.data               = rle_encode(rle_case.frame.data);
+        ASSERT_LT(compressed.data.size(), uncompressed.data.size()) << rle_case.name;
+
+        // Uncompressed data is sent a pixel at a time, as all images were before runs were sent whole
+        painter_device_t       reference = draw_reference(make_qgf(width, height, {uncompressed}), left, top);
+        painter_device_t       plain     = qp_virtual_make_rgb565_device(PANEL_WIDTH, PANEL_HEIGHT);
+        std::vector<uint8_t>   qgf       = make_qgf(width, height, {compressed});
+        painter_image_handle_t image     = qp_load_image_mem(qgf.data());
+        ASSERT_NE(image, nullptr) << rle_case.name;
+        ASSERT_TRUE(plain && qp_init(plain, QP_ROTATION_0));
+        qp_virtual_set_pixfill(plain, false);
+
+        ASSERT_TRUE(qp_drawimage(panel, left, top, image)) << rle_case.name;
+        ASSERT_TRUE(qp_drawimage(plain, left, top, image)) << rle_case.name;
+        expect_same_pixels(reference, rle_case.name);
+        expect_same_pixels(reference, rle_case.name, plain);
+        qp_close_image(image);
+
+        // Only QP_VIRTUAL_NUM_DEVICES panels can exist at once, so start the next case afresh
+        qp_virtual_reset();
+        panel = qp_virtual_make_rgb565_device(PANEL_WIDTH, PANEL_HEIGHT);
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+    }
+}
+
+#if QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+TEST_F(QpRender, AnimationCacheMatchesUncached) {
+    const uint16_t width = 32, height = 24, left = 50, top = 70, delay = 100;
+
+    // A palette frame, a recolored grayscale frame and a native frame, which each decode differently
+    std::vector<qgf_test_frame_t> frames = {
+        {PALETTE_4BPP, IMAGE_UNCOMPRESSED, {}, std::vector<uint8_t>(width * height / 2), delay},
+        {GRAYSCALE_2BPP, IMAGE_UNCOMPRESSED, {}, std::vector<uint8_t>(width * height / 4), delay},
+        {RGB565_16BPP, IMAGE_UNCOMPRESSED, {}, std::vector<uint8_t>(width * height * 2), delay},
+    };
+    for (uint8_t i = 0; i < 16; ++i) {
+        frames[0].palette.insert(frames[0].palette.end(), {(uint8_t)(i * 16), 255, (uint8_t)(128 + i * 8)});
+    }
+    for (size_t f = 0; f < frames.size(); ++f) {
+        for (size_t i = 0; i < frames[f].data.size(); ++i) {
+            frames[f].data[i] = i * 7 + f * 3;
+        }
+    }
+
+    // What each frame looks like drawn on its own with qp_drawimage_recolor(), which never uses the cache
+    auto uncached = [&](const std::vector<qgf_test_frame_t> &frames, uint8_t hue_fg, uint8_t hue_bg) {
+        std::vector<std::vector<uint32_t>> expected;
+        for (auto &frame : frames) {
+            std::vector<uint8_t>   qgf   = make_qgf(width, height, {frame});
+            painter_image_handle_t image = qp_load_image_mem(qgf.data());
+            EXPECT_TRUE(qp_drawimage_recolor(panel, 0, 0, image, hue_fg, 255, 255, hue_bg, 255, 64));
+            expected.push_back(capture(panel, 0, 0, width, height));
+            qp_close_image(image);
+        }
+        return expected;
+    };
+
+    // Plays the animation through twice from frame 0, the second time from the cache
+    auto play = [&](painter_image_handle_t image, uint8_t hue_fg, uint8_t hue_bg, const std::vector<std::vector<uint32_t>> &expected, const char *what) {
+        deferred_token token = qp_animate_recolor(panel, left, top, image, hue_fg, 255, 255, hue_bg, 255, 64);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN) << what;
+        for (size_t shown = 0; shown < 2 * expected.size(); ++shown) {
+            if (shown > 0) {
+                advance_time(delay);
+                qp_internal_animation_tick();
+            }
+            ASSERT_EQ(capture(panel, left, top, width, height), expected[shown % expected.size()]) << what << " frame " << shown;
+        }
+        qp_stop_animation(token);
+    };
+
+    std::vector<uint8_t>   qgf   = make_qgf(width, height, frames);
+    painter_image_handle_t image = qp_load_image_mem(qgf.data());
+    ASSERT_NE(image, nullptr);
+    ASSERT_EQ(image->frame_count, frames.size());
+    std::vector<std::vector<uint32_t>> expected = uncached(frames, 0, 170);
+    play(image, 0, 170, expected, "first");
+
+    // Changing the image data behind the handle proves the frames now come from the cache, even after loading
+    // another palette in between
+    for (auto &frame : frames) {
+        for (auto &byte : frame.data) {
+            byte = ~byte;
+        }
+    }
+    std::vector<std::vector<uint32_t>> changed = uncached(frames, 0, 170);
+    ASSERT_NE(changed, expected);
+    std::vector<uint8_t> changed_qgf = make_qgf(width, height, frames);
+    std::copy(changed_qgf.begin(), changed_qgf.end(), qgf.begin());
+    play(image, 0, 170, expected, "cached");
+
+    // Other colors aren't in the cache, nor is anything from an image once it's closed, even if its slot is reused
+    play(image, 85, 0, uncached(frames, 85, 0), "recolored");
+    ASSERT_TRUE(qp_close_image(image));
+    painter_image_handle_t reloaded = qp_load_image_mem(qgf.data());
+    ASSERT_EQ(reloaded, image);
+    play(reloaded, 0, 170, changed, "reloaded");
+    qp_close_image(reloaded);
+}
+#endif // QUANTUM_PAINTER_ANIMATION_CACHE_SIZE > 0
+
+TEST_F(QpRender, RendersScreens) {
+    const char *iterations_env = getenv("QP_RENDER_ITERATIONS");
+    const char *dump_dir       = getenv("QP_RENDER_DUMP_DIR");
+    uint32_t    iterations     = iterations_env ? strtoul(iterations_env, NULL, 10) : DEFAULT_ITERATIONS;
+
+    struct step_t {
+        const char           *name;
+        std::function<bool()> draw;
+    };
+    const step_t steps[] = {
+        {"fp_post_init_qp", [&] { return qp_init(panel, QP_ROTATION_0) && qp_rect(panel, 0, 0, PANEL_WIDTH, PANEL_HEIGHT, 0, 255, 255, true); }},
+        {"label_roboto18", [&] { return draw_centered_text(roboto18, "fingerpunch"); }},
+        {"label_urbanist36", [&] { return draw_centered_text(urbanist36, "fingerpunch"); }},
+        {"caps_lock_icons", [&] { return qp_drawimage(panel, 8, 8, caps_on) && qp_drawimage(panel, PANEL_WIDTH - 40, 8, caps_off); }},
+        {"clear", [&] { return qp_clear(panel); }},
+    };
+
+    printf("%-20s %8s %12s %14s %12s %12s\n", "step", "calls", "ns/call", "cycles/call", "pixels/call", "bytes/call");
+    for (auto &step : steps) {
+        qp_virtual_stats_t stats;
+        qp_virtual_clear_stats(panel);
+        for (uint32_t i = 0; i < iterations; ++i) {
+            ASSERT_TRUE(step.draw()) << step.name << " failed on iteration " << i;
+        }
+        qp_virtual_get_stats(panel, &stats);
+
+        if (dump_dir) {
+            char path[256];
+            snprintf(path, sizeof(path), "%s/%s.ppm", dump_dir, step.name);
+            ASSERT_TRUE(qp_virtual_write_ppm(panel, path, DUMP_SCALE)) << path;
+        }
+
+        if (stats.calls == 0) {
+            continue;
+        }
+        printf("%-20s %8lu %12llu %14llu %12lu %12lu\n", step.name, (unsigned long)(stats.calls / iterations), (unsigned long long)(stats.ns / stats.calls), (unsigned long long)(stats.cycles / stats.calls), (unsigned long)(stats.pixels / stats.calls), (unsigned long)(stats.bytes / stats.calls));
+    }
+}
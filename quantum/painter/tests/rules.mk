@@ -0,0 +1,41 @@
+qp_render_DEFS := -DQUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_SURFACE_ENABLE -DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE -DEEPROM_TEST_HARNESS
+qp_render_CONFIG := $(QUANTUM_PATH)/painter/tests/config_qp_render.h
+qp_render_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/comms \
+	$(DRIVER_PATH)/painter/generic \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+
+qp_render_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/qp_virtual.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
+	$(TOP_DIR)/keyboards/fingerpunch/personal/st7735_test/fonts/roboto18.qff.c \
+	$(TOP_DIR)/keyboards/fingerpunch/personal/st7735_test/fonts/urbanist36.qff.c \
+	$(TOP_DIR)/keyboards/tzarc/djinn/graphics/lock-caps-ON.qgf.c \
+	$(TOP_DIR)/keyboards/tzarc/djinn/graphics/lock-caps-OFF.qgf.c \
+	$(QUANTUM_PATH)/painter/tests/qp_lz_vectors.c \
+	$(QUANTUM_PATH)/painter/tests/qp_render_tests.cpp
+
+qp_render_glyph_cache_DEFS := $(qp_render_DEFS) -DQUANTUM_PAINTER_GLYPH_CACHE_SIZE=8192
+qp_render_glyph_cache_CONFIG := $(qp_render_CONFIG)
+qp_render_glyph_cache_INC := $(qp_render_INC)
+qp_render_glyph_cache_SRC := $(qp_render_SRC)
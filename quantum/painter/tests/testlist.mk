@@ -0,0 +1 @@
+TEST_LIST += qp_render qp_render_glyph_cache
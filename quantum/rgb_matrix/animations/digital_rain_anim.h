@@ -18,65 +18,74 @@ bool DIGITAL_RAIN(effect_params_t* params) {
     static uint8_t drop  = 0;
     static uint8_t decay = 0;
 
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
-        memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+        rgb_matrix_framebuffer_clear();
         drop = 0;
     }
 
-    decay++;
-    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-            if (row == 0 && drop == 0 && rand() < RAND_MAX / RGB_DIGITAL_RAIN_DROPS) {
-                // top row, pixels have just fallen and we're
-                // making a new rain drop in this column
-                g_rgb_frame_buffer[row][col] = max_intensity;
-            } else if (g_rgb_frame_buffer[row][col] > 0 && g_rgb_frame_buffer[row][col] < max_intensity) {
-                // neither fully bright nor dark, decay it
-                if (decay == decay_ticks) {
-                    g_rgb_frame_buffer[row][col]--;
+    // Move the rain once per frame, the drawing below is spread over the iterations
+    if (params->iter == 0) {
+        if (++decay >= decay_ticks) {
+            decay = 0;
+            // decay the pixels that are neither fully bright nor dark, skipping the dark ones
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                matrix_row_t active = g_rgb_frame_buffer_active[row];
+                for (uint8_t col = 0; active; col++, active >>= 1) {
+                    if ((active & 1) && g_rgb_frame_buffer[row][col] < max_intensity) {
+                        rgb_matrix_framebuffer_set(row, col, g_rgb_frame_buffer[row][col] - 1);
+                    }
                 }
             }
-            // set the pixel colour
-            uint8_t led[LED_HITS_TO_REMEMBER];
-            uint8_t led_count = rgb_matrix_map_row_column_to_led(row, col, led);
+        }
 
-            // TODO: multiple leds are supported mapped to the same row/column
-            if (led_count > 0) {
-                if (g_rgb_frame_buffer[row][col] > pure_green_intensity) {
-                    const uint8_t boost = (uint8_t)((uint16_t)max_brightness_boost * (g_rgb_frame_buffer[row][col] - pure_green_intensity) / (max_intensity - pure_green_intensity));
-                    rgb_matrix_set_color(led[0], boost, max_intensity, boost);
-                } else {
-                    const uint8_t green = (uint8_t)((uint16_t)max_intensity * g_rgb_frame_buffer[row][col] / pure_green_intensity);
-                    rgb_matrix_set_color(led[0], 0, green, 0);
+        if (drop == 0) {
+            // pixels have just fallen, start new rain drops on the top row
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if (random16() < UINT16_MAX / RGB_DIGITAL_RAIN_DROPS) {
+                    rgb_matrix_framebuffer_set(0, col, max_intensity);
                 }
             }
         }
-    }
-    if (decay == decay_ticks) {
-        decay = 0;
-    }
 
-    if (++drop > drop_ticks) {
-        // reset drop timer
-        drop = 0;
-        for (uint8_t row = MATRIX_ROWS - 1; row > 0; row--) {
-            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-                // if ths is on the bottom row and bright allow decay
-                if (row == MATRIX_ROWS - 1 && g_rgb_frame_buffer[row][col] == max_intensity) {
-                    g_rgb_frame_buffer[row][col]--;
-                }
-                // check if the pixel above is bright
-                if (g_rgb_frame_buffer[row - 1][col] >= max_intensity) { // Note: can be larger than max_intensity if val was recently decreased
-                    // allow old bright pixel to decay
-                    g_rgb_frame_buffer[row - 1][col] = max_intensity - 1;
-                    // make this pixel bright
-                    g_rgb_frame_buffer[row][col] = max_intensity;
+        if (++drop > drop_ticks) {
+            // reset drop timer
+            drop = 0;
+            for (uint8_t row = MATRIX_ROWS - 1; row > 0; row--) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    // if ths is on the bottom row and bright allow decay
+                    if (row == MATRIX_ROWS - 1 && g_rgb_frame_buffer[row][col] == max_intensity) {
+                        rgb_matrix_framebuffer_set(row, col, max_intensity - 1);
+                    }
+                    // check if the pixel above is bright
+                    if (g_rgb_frame_buffer[row - 1][col] >= max_intensity) { // Note: can be larger than max_intensity if val was recently decreased
+                        // allow old bright pixel to decay
+                        rgb_matrix_framebuffer_set(row - 1, col, max_intensity - 1);
+                        // make this pixel bright
+                        rgb_matrix_framebuffer_set(row, col, max_intensity);
+                    }
                 }
             }
         }
     }
-    return false;
+
+    for (uint8_t i = led_min; i < led_max; i++) {
+        uint8_t row, col;
+        if (!rgb_matrix_framebuffer_cell(i, &row, &col)) continue;
+
+        // set the pixel colour
+        uint8_t val = g_rgb_frame_buffer[row][col];
+        if (val > pure_green_intensity) {
+            const uint8_t boost = (uint8_t)((uint16_t)max_brightness_boost * (val - pure_green_intensity) / (max_intensity - pure_green_intensity));
+            rgb_matrix_set_color(i, boost, max_intensity, boost);
+        } else {
+            const uint8_t green = (uint8_t)((uint16_t)max_intensity * val / pure_green_intensity);
+            rgb_matrix_set_color(i, 0, green, 0);
+        }
+    }
+    return rgb_matrix_check_finished_leds(led_max);
 }
 
 #    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
@@ -6,14 +6,15 @@ RGB_MATRIX_EFFECT(RIVERFLOW)
 
 bool RIVERFLOW(effect_params_t* params) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    RGB_MATRIX_HSV_BATCH(batch);
     for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
         HSV      hsv  = rgb_matrix_config.hsv;
         uint16_t time = scale16by8(g_rgb_timer + (i * 315), rgb_matrix_config.speed / 8);
         hsv.v         = scale8(abs8(sin8(time) - 128) * 2, hsv.v);
-        RGB rgb       = rgb_matrix_hsv_to_rgb(hsv);
-        RGB_MATRIX_TEST_LED_FLAGS();
-        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+        rgb_matrix_hsv_batch_add(&batch, i, hsv);
     }
+    rgb_matrix_hsv_batch_flush(&batch);
 
     return rgb_matrix_check_finished_leds(led_max);
 }
@@ -0,0 +1,20 @@
+#pragma once
+
+typedef HSV (*dist_angle_f)(HSV hsv, uint8_t dist, uint8_t angle, uint8_t time);
+
+bool effect_runner_dist_angle(effect_params_t* params, dist_angle_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    RGB_MATRIX_HSV_BATCH(batch);
+
+    uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        int16_t dx    = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy    = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        uint8_t dist  = rgb_matrix_led_dist(i, dx, dy);
+        uint8_t angle = rgb_matrix_led_angle(i, dx, dy);
+        rgb_matrix_hsv_batch_add(&batch, i, effect_func(rgb_matrix_config.hsv, dist, angle, time));
+    }
+    rgb_matrix_hsv_batch_flush(&batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
@@ -6,14 +6,14 @@ void set_starlight_color(int i, effect_params_t* params) {
     uint16_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 8);
     HSV      hsv  = rgb_matrix_config.hsv;
     hsv.v         = scale8(abs8(sin8(time) - 128) * 2, hsv.v);
-    RGB rgb       = hsv_to_rgb(hsv);
+    RGB rgb       = rgb_matrix_hsv_to_rgb(hsv);
     rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
 }
 
 bool STARLIGHT(effect_params_t* params) {
     if (!params->init) {
         if (scale16by8(g_rgb_timer, qadd8(rgb_matrix_config.speed, 5)) % 5 == 0) {
-            int rand_led = rand() % RGB_MATRIX_LED_COUNT;
+            uint8_t rand_led = random8_max(RGB_MATRIX_LED_COUNT);
             set_starlight_color(rand_led, params);
         }
         return false;
@@ -16,31 +16,105 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
 #            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
 #        endif
+
+#        define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
+
+static inline uint8_t typing_heatmap_spread_amount(uint8_t distance) {
+    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+    }
+    return amount;
+}
+
+#        if RGB_MATRIX_GEOMETRY_TABLE && !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM)
+// Set when the effect starts, as the check is far too slow to run on a keypress
+static bool typing_heatmap_table_usable = false;
+
+static bool typing_heatmap_table_check(void) {
+    if (g_rgb_matrix_heatmap_index == NULL || g_rgb_matrix_heatmap_neighbours == NULL || g_rgb_matrix_heatmap_radius < RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+        return false;
+    }
+    if (pgm_read_word(&g_rgb_matrix_heatmap_index[0]) != 0) {
+        return false;
+    }
+    // Each key's list has to hold exactly the other keys within the radius, in matrix order, as the generator emits them
+    uint16_t listed = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led = g_led_config.matrix_co[row][col];
+            if (led == NO_LED) {
+                continue;
+            }
+            uint16_t i   = pgm_read_word(&g_rgb_matrix_heatmap_index[led]);
+            uint16_t end = pgm_read_word(&g_rgb_matrix_heatmap_index[led + 1]);
+            listed += end - i;
+            for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+                for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+                    uint8_t other = g_led_config.matrix_co[i_row][i_col];
+                    if (other == NO_LED || other == led) {
+                        continue;
+                    }
+                    uint8_t distance = LED_DISTANCE(g_led_config.point[led], g_led_config.point[other]);
+                    if (distance > g_rgb_matrix_heatmap_radius) {
+                        continue;
+                    }
+                    led_neighbour_t neighbour;
+                    if (i >= end) {
+                        return false;
+                    }
+                    memcpy_P(&neighbour, &g_rgb_matrix_heatmap_neighbours[i++], sizeof(neighbour));
+                    if (neighbour.row != i_row || neighbour.col != i_col || neighbour.dist != distance) {
+                        return false;
+                    }
+                }
+            }
+            if (i != end) {
+                return false;
+            }
+        }
+    }
+    // LEDs without a key must not have lists of their own
+    return listed == pgm_read_word(&g_rgb_matrix_heatmap_index[RGB_MATRIX_LED_COUNT]);
+}
+
+#        endif
+
 void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
     // Limit effect to pressed keys
-    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+    rgb_matrix_framebuffer_add(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
 #        else
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
     }
+#            if RGB_MATRIX_GEOMETRY_TABLE
+    if (typing_heatmap_table_usable) {
+        uint8_t  led = g_led_config.matrix_co[row][col];
+        uint16_t end = pgm_read_word(&g_rgb_matrix_heatmap_index[led + 1]);
+
+        rgb_matrix_framebuffer_add(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+        for (uint16_t i = pgm_read_word(&g_rgb_matrix_heatmap_index[led]); i < end; i++) {
+            led_neighbour_t neighbour;
+            memcpy_P(&neighbour, &g_rgb_matrix_heatmap_neighbours[i], sizeof(neighbour));
+            if (neighbour.dist <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                rgb_matrix_framebuffer_add(neighbour.row, neighbour.col, typing_heatmap_spread_amount(neighbour.dist));
+            }
+        }
+        return;
+    }
+#            endif
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
             if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
                 continue;
             }
             if (i_row == row && i_col == col) {
-                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+                rgb_matrix_framebuffer_add(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
             } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
                 uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
                 if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
-                    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
-                    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
-                        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
-                    }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+                    rgb_matrix_framebuffer_add(i_row, i_col, typing_heatmap_spread_amount(distance));
                 }
             }
         }
@@ -48,6 +122,8 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        endif
 }
 
+#        undef LED_DISTANCE
+
 // A timer to track the last time we decremented all heatmap values.
 static uint16_t heatmap_decrease_timer;
 // Whether we should decrement the heatmap values during the next update.
@@ -58,7 +134,11 @@ bool TYPING_HEATMAP(effect_params_t* params) {
 
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
-        memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+        rgb_matrix_framebuffer_clear();
+#        if RGB_MATRIX_GEOMETRY_TABLE && !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM)
+        // The lists are generated from info.json, so only trust them if g_led_config has not been replaced since
+        typing_heatmap_table_usable = typing_heatmap_table_check();
+#        endif
     }
 
     // The heatmap animation might run in several iterations depending on
@@ -73,24 +153,23 @@ bool TYPING_HEATMAP(effect_params_t* params) {
         }
     }
 
-    // Render heatmap & decrease
-    uint8_t count = 0;
-    for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
-            if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
-                count++;
-                uint8_t val = g_rgb_frame_buffer[row][col];
-                if (!HAS_ANY_FLAGS(g_led_config.flags[g_led_config.matrix_co[row][col]], params->flags)) continue;
-
-                HSV hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
-                RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
-                rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
-
-                if (decrease_heatmap_values) {
-                    g_rgb_frame_buffer[row][col] = qsub8(val, 1);
-                }
-            }
-        }
+    // Render heatmap
+    RGB_MATRIX_HSV_BATCH(batch);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        uint8_t row, col;
+        if (!rgb_matrix_framebuffer_cell(i, &row, &col)) continue;
+        RGB_MATRIX_TEST_LED_FLAGS();
+
+        uint8_t val = g_rgb_frame_buffer[row][col];
+        HSV     hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
+        rgb_matrix_hsv_batch_add(&batch, i, hsv);
+    }
+
+    rgb_matrix_hsv_batch_flush(&batch);
+
+    // Decrease only the part of the heatmap drawn in this iteration
+    if (decrease_heatmap_values) {
+        rgb_matrix_framebuffer_decay(led_min, led_max, 1);
     }
 
     return rgb_matrix_check_finished_leds(led_max);
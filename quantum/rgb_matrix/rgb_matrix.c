@@ -29,14 +29,108 @@
 
 #include <lib/lib8tion/lib8tion.h>
 
+#if RGB_MATRIX_RENDER_BUDGET_US > 0
+#    ifndef RGB_MATRIX_RENDER_CLOCK
+#        if defined(PROTOCOL_CHIBIOS) && defined(PORT_SUPPORTS_RT) && PORT_SUPPORTS_RT == TRUE
+#            include <ch.h>
+#            define RGB_MATRIX_RENDER_CLOCK() ((uint32_t)chSysGetRealtimeCounterX())
+#        else
+#            error "RGB_MATRIX_RENDER_BUDGET_US needs a free running counter, define RGB_MATRIX_RENDER_CLOCK() for this platform"
+#        endif
+#    endif
+#endif
+
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
 #else
 const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
+// The colour correction stage applies its own lightness curve
 __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
+#ifdef RGB_MATRIX_CORRECTION
+    return hsv_to_rgb_nocie(hsv);
+#else
     return hsv_to_rgb(hsv);
+#endif
+}
+
+// Goes through rgb_matrix_hsv_to_rgb() so that keyboards overriding it also change the batched effects
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+}
+
+// Effects queue up the HSV colour of each LED and convert them together,
+// RGB_MATRIX_HSV_BATCH_SIZE at a time, rather than one call per LED
+typedef struct {
+    HSV     hsv[RGB_MATRIX_HSV_BATCH_SIZE];
+    uint8_t index[RGB_MATRIX_HSV_BATCH_SIZE];
+    uint8_t count;
+} rgb_matrix_hsv_batch_t;
+
+#define RGB_MATRIX_HSV_BATCH(name) \
+    rgb_matrix_hsv_batch_t name;   \
+    name.count = 0
+
+static void rgb_matrix_hsv_batch_flush(rgb_matrix_hsv_batch_t *batch) {
+    RGB rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+
+    rgb_matrix_hsv_to_rgb_batch(batch->hsv, rgb, batch->count);
+    for (uint8_t n = 0; n < batch->count; n++) {
+        rgb_matrix_set_color(batch->index[n], rgb[n].r, rgb[n].g, rgb[n].b);
+    }
+    batch->count = 0;
+}
+
+static inline void rgb_matrix_hsv_batch_add(rgb_matrix_hsv_batch_t *batch, uint8_t index, HSV hsv) {
+    batch->index[batch->count] = index;
+    batch->hsv[batch->count]   = hsv;
+    if (++batch->count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        rgb_matrix_hsv_batch_flush(batch);
+    }
+}
+
+#if RGB_MATRIX_GEOMETRY_TABLE
+static bool rgb_matrix_geometry_valid = false;
+
+static void rgb_matrix_geometry_init(void) {
+    // The table was generated from info.json, but g_led_config or the centre may have been overridden since
+    rgb_matrix_geometry_valid = false;
+    if (g_rgb_matrix_geometry == NULL) {
+        return;
+    }
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        led_geometry_t geometry;
+        memcpy_P(&geometry, &g_rgb_matrix_geometry[i], sizeof(geometry));
+        if (geometry.dx != g_led_config.point[i].x - k_rgb_matrix_center.x || geometry.dy != g_led_config.point[i].y - k_rgb_matrix_center.y) {
+            dprintf("rgb_matrix: geometry table does not match g_led_config, ignoring it\n");
+            return;
+        }
+    }
+    rgb_matrix_geometry_valid = true;
+}
+#endif // RGB_MATRIX_GEOMETRY_TABLE
+
+// Distance of LED i from k_rgb_matrix_center, given its offset from it
+static inline uint8_t rgb_matrix_led_dist(uint8_t i, int16_t dx, int16_t dy) {
+#if RGB_MATRIX_GEOMETRY_TABLE
+    if (rgb_matrix_geometry_valid) {
+        return pgm_read_byte(&g_rgb_matrix_geometry[i].dist);
+    }
+#endif
+    return sqrt16(dx * dx + dy * dy);
+}
+
+// Angle of LED i around k_rgb_matrix_center, given its offset from it
+static inline uint8_t rgb_matrix_led_angle(uint8_t i, int16_t dx, int16_t dy) {
+#if RGB_MATRIX_GEOMETRY_TABLE
+    if (rgb_matrix_geometry_valid) {
+        return pgm_read_byte(&g_rgb_matrix_geometry[i].angle);
+    }
+#endif
+    return atan2_8(dy, dx);
 }
 
 // Generic effect runners
@@ -64,7 +158,8 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
 rgb_config_t rgb_matrix_config; // TODO: would like to prefix this with g_ for global consistancy, do this in another pr
 uint32_t     g_rgb_timer;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
-uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+uint8_t      g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+matrix_row_t g_rgb_frame_buffer_active[MATRIX_ROWS]       = {0};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
@@ -76,6 +171,14 @@ static uint8_t         rgb_last_enable   = UINT8_MAX;
 static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
+static bool            rgb_driver_asleep = false;
+#if RGB_MATRIX_RENDER_BUDGET_US > 0
+// Number of LEDs in each pass of the frame being rendered, chosen at the start of the frame
+static uint8_t  rgb_render_pass_size = RGB_MATRIX_LED_PROCESS_LIMIT;
+static uint32_t rgb_render_budget_ticks;
+// Per-LED render cost of each effect in sixteenths of a clock tick, 0 until measured
+static uint32_t rgb_render_cost[RGB_MATRIX_EFFECT_MAX];
+#endif // RGB_MATRIX_RENDER_BUDGET_US > 0
 
 // double buffers
 static uint32_t rgb_timer_buffer;
@@ -139,16 +242,92 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
     return led_count;
 }
 
+#ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
+// Matrix position of each LED's key, NO_LED for LEDs without one
+static uint8_t rgb_frame_buffer_row[RGB_MATRIX_LED_COUNT];
+static uint8_t rgb_frame_buffer_col[RGB_MATRIX_LED_COUNT];
+
+static void rgb_matrix_framebuffer_init(void) {
+    memset(rgb_frame_buffer_row, NO_LED, sizeof(rgb_frame_buffer_row));
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led = g_led_config.matrix_co[row][col];
+            if (led < RGB_MATRIX_LED_COUNT) {
+                rgb_frame_buffer_row[led] = row;
+                rgb_frame_buffer_col[led] = col;
+            }
+        }
+    }
+    rgb_matrix_framebuffer_clear();
+}
+
+void rgb_matrix_framebuffer_clear(void) {
+    memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+    memset(g_rgb_frame_buffer_active, 0, sizeof(g_rgb_frame_buffer_active));
+}
+
+void rgb_matrix_framebuffer_set(uint8_t row, uint8_t col, uint8_t value) {
+    g_rgb_frame_buffer[row][col] = value;
+    if (value) {
+        g_rgb_frame_buffer_active[row] |= MATRIX_ROW_SHIFTER << col;
+    } else {
+        g_rgb_frame_buffer_active[row] &= ~(MATRIX_ROW_SHIFTER << col);
+    }
+}
+
+void rgb_matrix_framebuffer_add(uint8_t row, uint8_t col, uint8_t amount) {
+    rgb_matrix_framebuffer_set(row, col, qadd8(g_rgb_frame_buffer[row][col], amount));
+}
+
+bool rgb_matrix_framebuffer_cell(uint8_t led, uint8_t *row, uint8_t *col) {
+    if (led >= RGB_MATRIX_LED_COUNT || rgb_frame_buffer_row[led] == NO_LED) {
+        return false;
+    }
+    *row = rgb_frame_buffer_row[led];
+    *col = rgb_frame_buffer_col[led];
+    return true;
+}
+
+void rgb_matrix_framebuffer_decay(uint8_t led_min, uint8_t led_max, uint8_t amount) {
+    for (uint8_t i = led_min; i < led_max; i++) {
+        uint8_t row = rgb_frame_buffer_row[i];
+        if (row == NO_LED) {
+            continue;
+        }
+        uint8_t col = rgb_frame_buffer_col[i];
+        if (g_rgb_frame_buffer_active[row] & (MATRIX_ROW_SHIFTER << col)) {
+            rgb_matrix_framebuffer_set(row, col, qsub8(g_rgb_frame_buffer[row][col], amount));
+        }
+    }
+}
+#endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
+
 void rgb_matrix_update_pwm_buffers(void) {
+#if defined(RGB_MATRIX_LAYERS)
+    rgb_matrix_layers_flush();
+#elif defined(RGB_MATRIX_CORRECTION)
+    rgb_matrix_correction_flush();
+#else
     rgb_matrix_driver.flush();
+#endif
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#if defined(RGB_MATRIX_LAYERS)
+    rgb_matrix_layers_set_base(index, red, green, blue);
+#elif defined(RGB_MATRIX_CORRECTION)
+    rgb_matrix_correction_set_color(index, red, green, blue);
+#else
     rgb_matrix_driver.set_color(index, red, green, blue);
+#endif
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_LAYERS)
+    rgb_matrix_layers_set_base_all(red, green, blue);
+#elif defined(RGB_MATRIX_CORRECTION)
+    rgb_matrix_correction_set_color_all(red, green, blue);
+#elif defined(RGB_MATRIX_SPLIT)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -278,6 +457,65 @@ static void rgb_task_start(void) {
     rgb_task_state = RENDERING;
 }
 
+#if RGB_MATRIX_RENDER_BUDGET_US > 0
+// The render clock rate is measured against the millisecond timer over this long, from the first render passes
+#    define RGB_MATRIX_RENDER_CALIBRATION_MS 250
+
+static void rgb_render_calibrate(uint32_t now_ticks) {
+    static uint32_t start_ms;
+    static uint32_t start_ticks;
+    static bool     started = false;
+
+    uint32_t now_ms  = timer_read32();
+    uint32_t elapsed = now_ms - start_ms;
+    // Start over after a long gap without rendering, the render clock may have wrapped around meanwhile
+    if (!started || elapsed > RGB_MATRIX_RENDER_CALIBRATION_MS * 4) {
+        start_ms    = now_ms;
+        start_ticks = now_ticks;
+        started     = true;
+        return;
+    }
+    if (elapsed < RGB_MATRIX_RENDER_CALIBRATION_MS) {
+        return;
+    }
+
+    uint32_t ticks_per_ms   = (now_ticks - start_ticks) / elapsed;
+    rgb_render_budget_ticks = (uint32_t)(((uint64_t)ticks_per_ms * RGB_MATRIX_RENDER_BUDGET_US) / 1000);
+    dprintf("rgb_matrix: %lu render clock ticks per ms\n", (unsigned long)ticks_per_ms);
+}
+
+static void rgb_render_plan_frame(uint8_t effect) {
+    uint32_t count = RGB_MATRIX_LED_PROCESS_LIMIT;
+    if (rgb_render_budget_ticks > 0 && effect < RGB_MATRIX_EFFECT_MAX && rgb_render_cost[effect] > 0) {
+        count = (uint32_t)(((uint64_t)rgb_render_budget_ticks * 16) / rgb_render_cost[effect]);
+    }
+    if (count < 1) {
+        count = 1;
+    } else if (count > RGB_MATRIX_LED_COUNT) {
+        count = RGB_MATRIX_LED_COUNT;
+    }
+    rgb_render_pass_size = count;
+}
+
+static void rgb_render_measure_pass(uint8_t effect, uint32_t elapsed) {
+    struct rgb_matrix_limits_t limits = rgb_matrix_get_limits(rgb_effect_params.iter);
+    uint8_t                    count  = limits.led_max_index - limits.led_min_index;
+    // The first pass of an effect may do one-off work, so leave it out of the estimate
+    if (effect >= RGB_MATRIX_EFFECT_MAX || count == 0 || rgb_effect_params.init) {
+        return;
+    }
+
+    uint32_t cost = (elapsed * 16) / count;
+    if (cost == 0) {
+        cost = 1;
+    }
+    if (rgb_render_cost[effect] > 0) {
+        cost = (rgb_render_cost[effect] * 3 + cost) / 4;
+    }
+    rgb_render_cost[effect] = cost;
+}
+#endif // RGB_MATRIX_RENDER_BUDGET_US > 0
+
 static void rgb_task_render(uint8_t effect) {
     bool rendering         = false;
     rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
@@ -286,6 +524,17 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#if RGB_MATRIX_RENDER_BUDGET_US > 0
+    // Every pass of a frame has the same size, so that the limits of any pass follow from its iter
+    if (rgb_effect_params.iter == 0) {
+        rgb_render_plan_frame(effect);
+    }
+    uint32_t render_start = RGB_MATRIX_RENDER_CLOCK();
+    if (rgb_render_budget_ticks == 0) {
+        rgb_render_calibrate(render_start);
+    }
+#endif // RGB_MATRIX_RENDER_BUDGET_US > 0
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -326,6 +575,10 @@ static void rgb_task_render(uint8_t effect) {
             return;
     }
 
+#if RGB_MATRIX_RENDER_BUDGET_US > 0
+    rgb_render_measure_pass(effect, RGB_MATRIX_RENDER_CLOCK() - render_start);
+#endif // RGB_MATRIX_RENDER_BUDGET_US > 0
+
     rgb_effect_params.iter++;
 
     // next task
@@ -343,6 +596,11 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+#ifdef RGB_MATRIX_LAYERS
+    // Lighting layers go dark along with the indicators while the matrix is off or suspended
+    rgb_matrix_layers_set_visible(effect != RGB_MATRIX_NONE);
+#endif
+
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
@@ -350,18 +608,54 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_task_state = SYNCING;
 }
 
+static void rgb_task_blank(void) {
+    // Going dark isn't a change of effect, so keep the current one from being reinitialised afterwards
+    uint8_t last_effect = rgb_last_effect;
+    rgb_task_render(0);
+    rgb_task_flush(0);
+    rgb_last_effect = last_effect;
+}
+
+static void rgb_task_sleep(void) {
+    if (!rgb_driver_asleep) {
+        // Blank the LEDs once, then leave the driver alone until woken
+        rgb_task_blank();
+        if (rgb_matrix_driver.shutdown) {
+            rgb_matrix_driver.shutdown();
+        }
+        rgb_driver_asleep = true;
+    }
+    eeconfig_flush_rgb_matrix(false);
+}
+
+static void rgb_task_wake(void) {
+    if (rgb_matrix_driver.exit_shutdown) {
+        rgb_matrix_driver.exit_shutdown();
+    }
+    rgb_driver_asleep = false;
+    rgb_task_state    = STARTING;
+}
+
 void rgb_matrix_task(void) {
     rgb_task_timers();
 
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
 #if RGB_MATRIX_TIMEOUT > 0
                              (last_input_activity_elapsed() > (uint32_t)RGB_MATRIX_TIMEOUT) ||
 #endif // RGB_MATRIX_TIMEOUT > 0
                              false;
 
-    uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
+    // While suspended or timed out the LEDs are dark and the driver is shut
+    // down, so there is nothing to render until there is activity again
+    if (suspend_backlight) {
+        rgb_task_sleep();
+        return;
+    }
+    if (rgb_driver_asleep) {
+        rgb_task_wake();
+    }
+
+    uint8_t effect = rgb_matrix_config.enable ? rgb_matrix_config.mode : 0;
 
     switch (rgb_task_state) {
         case STARTING:
@@ -399,31 +693,48 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#if RGB_MATRIX_RENDER_BUDGET_US > 0
+    uint8_t min = 0;
+    uint8_t max = RGB_MATRIX_LED_COUNT;
 #    if defined(RGB_MATRIX_SPLIT)
+    const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
+    if (is_keyboard_left()) {
+        max = k_rgb_matrix_split[0];
+    } else {
+        min = k_rgb_matrix_split[0];
+    }
+#    endif
+    uint16_t start       = min + (uint16_t)rgb_render_pass_size * iter;
+    uint16_t end         = start + rgb_render_pass_size;
+    limits.led_min_index = start < max ? start : max;
+    limits.led_max_index = end < max ? end : max;
+#else
+#    if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#        if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
     if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
     uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
     if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
     if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
-#    else
+#        else
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
     if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
-#    endif
-#else
-#    if defined(RGB_MATRIX_SPLIT)
+#        endif
+#    else
+#        if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index                = 0;
     limits.led_max_index                = RGB_MATRIX_LED_COUNT;
     const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
     if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
     if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
-#    else
+#        else
     limits.led_min_index = 0;
     limits.led_max_index = RGB_MATRIX_LED_COUNT;
+#        endif
 #    endif
-#endif
+#endif // RGB_MATRIX_RENDER_BUDGET_US > 0
     return limits;
 }
 
@@ -448,6 +759,21 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#if RGB_MATRIX_GEOMETRY_TABLE
+    rgb_matrix_geometry_init();
+#endif
+
+#ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
+    rgb_matrix_framebuffer_init();
+#endif
+
+#ifdef RGB_MATRIX_LAYERS
+    rgb_matrix_layers_init();
+#endif
+#ifdef RGB_MATRIX_CORRECTION
+    rgb_matrix_correction_init();
+#endif
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -471,8 +797,7 @@ void rgb_matrix_init(void) {
 void rgb_matrix_set_suspend_state(bool state) {
 #ifdef RGB_MATRIX_SLEEP
     if (state && !suspend_state) { // only run if turning off, and only once
-        rgb_task_render(0);        // turn off all LEDs when suspending
-        rgb_task_flush(0);         // and actually flash led state to LEDs
+        rgb_task_blank();          // turn off all LEDs when suspending
     }
     suspend_state = state;
 #endif
@@ -22,8 +22,11 @@
 #include <stdbool.h>
 #include "rgb_matrix_types.h"
 #include "rgb_matrix_drivers.h"
+#include "rgb_matrix_layers.h"
+#include "rgb_matrix_correction.h"
 #include "color.h"
 #include "keyboard.h"
+#include "matrix.h"
 
 #ifndef RGB_MATRIX_TIMEOUT
 #    define RGB_MATRIX_TIMEOUT 0
@@ -49,6 +52,16 @@
 #    define RGB_MATRIX_SPD_STEP 16
 #endif
 
+// Let effects use the per-LED geometry table generated alongside g_led_config instead of
+// recomputing distances and angles every frame. Off on AVR, where flash is usually tighter than time.
+#ifndef RGB_MATRIX_GEOMETRY_TABLE
+#    ifdef __AVR__
+#        define RGB_MATRIX_GEOMETRY_TABLE 0
+#    else
+#        define RGB_MATRIX_GEOMETRY_TABLE 1
+#    endif
+#endif
+
 #ifndef RGB_MATRIX_DEFAULT_ON
 #    define RGB_MATRIX_DEFAULT_ON true
 #endif
@@ -90,6 +103,19 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+// When non-zero, size each render pass so it takes about this many microseconds, based on the
+// measured per-LED cost of the current effect. RGB_MATRIX_LED_PROCESS_LIMIT is then only used
+// until the render clock has been timed, over the first quarter second of rendering, and for the
+// first frame of an effect that has not been measured yet.
+#ifndef RGB_MATRIX_RENDER_BUDGET_US
+#    define RGB_MATRIX_RENDER_BUDGET_US 0
+#endif
+
+// Number of LEDs the effect runners convert from HSV to RGB in one go
+#ifndef RGB_MATRIX_HSV_BATCH_SIZE
+#    define RGB_MATRIX_HSV_BATCH_SIZE 16
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -150,6 +176,18 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
+#ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
+// Framebuffer effects should write g_rgb_frame_buffer through these, so that
+// cells which are already zero can be skipped
+void rgb_matrix_framebuffer_clear(void);
+void rgb_matrix_framebuffer_set(uint8_t row, uint8_t col, uint8_t value);
+void rgb_matrix_framebuffer_add(uint8_t row, uint8_t col, uint8_t amount);
+// Matrix position of the key lit by an LED, false if it has none
+bool rgb_matrix_framebuffer_cell(uint8_t led, uint8_t *row, uint8_t *col);
+// Lower the cells of the LEDs in led_min..led_max, so that decay can be spread over the render passes like drawing is
+void rgb_matrix_framebuffer_decay(uint8_t led_min, uint8_t led_max, uint8_t amount);
+#endif
+
 void rgb_matrix_task(void);
 
 // This runs after another backlight effect and replaces
@@ -271,9 +309,22 @@ extern rgb_config_t rgb_matrix_config;
 
 extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
+#if RGB_MATRIX_GEOMETRY_TABLE
+// Only generated for keyboards whose g_led_config comes from info.json, hence weak
+extern const led_geometry_t g_rgb_matrix_geometry[RGB_MATRIX_LED_COUNT] __attribute__((weak));
+#    if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP) && !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM)
+// Keys within g_rgb_matrix_heatmap_radius of the key lit by LED i are
+// g_rgb_matrix_heatmap_neighbours[g_rgb_matrix_heatmap_index[i]] up to [g_rgb_matrix_heatmap_index[i + 1]]
+extern const uint8_t         g_rgb_matrix_heatmap_radius __attribute__((weak));
+extern const uint16_t        g_rgb_matrix_heatmap_index[RGB_MATRIX_LED_COUNT + 1] __attribute__((weak));
+extern const led_neighbour_t g_rgb_matrix_heatmap_neighbours[] __attribute__((weak));
+#    endif
+#endif
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
+// One bit per non-zero cell of g_rgb_frame_buffer, kept up to date by rgb_matrix_framebuffer_set()
+extern matrix_row_t g_rgb_frame_buffer_active[MATRIX_ROWS];
 #endif
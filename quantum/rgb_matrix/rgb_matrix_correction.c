@@ -0,0 +1,101 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+#ifdef RGB_MATRIX_CORRECTION
+
+#    include <math.h>
+
+// Highest table entry, so that adding a carried error of up to 255 cannot overflow
+#    define LEVEL_MAX (UINT8_MAX << 8)
+
+static const float channel_gamma[3] = {RGB_MATRIX_GAMMA_RED, RGB_MATRIX_GAMMA_GREEN, RGB_MATRIX_GAMMA_BLUE};
+
+static uint16_t levels[3][256];
+static RGB      target[RGB_MATRIX_LED_COUNT];
+static uint8_t  error[RGB_MATRIX_LED_COUNT][3];
+
+static float lightness_to_luminance(float lightness, float exponent) {
+    if (exponent > 0) {
+        return powf(lightness, exponent);
+    }
+    // CIE 1931, with lightness scaled to 0..1 rather than 0..100
+    if (lightness <= 0.08f) {
+        return lightness * (100.0f / 903.3f);
+    }
+    float y = (lightness + 0.16f) / 1.16f;
+    return y * y * y;
+}
+
+static void fill_levels(uint8_t channel, uint8_t white) {
+    float scale = (float)LEVEL_MAX * white / UINT8_MAX;
+    for (uint16_t i = 0; i < 256; i++) {
+        levels[channel][i] = (uint16_t)(lightness_to_luminance(i / 255.0f, channel_gamma[channel]) * scale + 0.5f);
+    }
+}
+
+static inline uint8_t dither(uint16_t level, uint8_t *carry) {
+    uint16_t sum = level + *carry;
+    *carry       = sum & 0xFF;
+    return sum >> 8;
+}
+
+void rgb_matrix_correction_set_white_balance(uint8_t red, uint8_t green, uint8_t blue) {
+    fill_levels(0, red);
+    fill_levels(1, green);
+    fill_levels(2, blue);
+}
+
+void rgb_matrix_correction_init(void) {
+    const uint8_t white[3] = RGB_MATRIX_WHITE_BALANCE;
+    rgb_matrix_correction_set_white_balance(white[0], white[1], white[2]);
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        target[i] = (RGB){0};
+        // Start each LED at a different phase so they do not all step up on the same frame
+        for (uint8_t c = 0; c < 3; c++) {
+            error[i][c] = i * 157 + c * 85;
+        }
+    }
+}
+
+void rgb_matrix_correction_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+    target[index].r = red;
+    target[index].g = green;
+    target[index].b = blue;
+}
+
+void rgb_matrix_correction_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_matrix_correction_set_color(i, red, green, blue);
+    }
+}
+
+void rgb_matrix_correction_flush(void) {
+    uint8_t min = 0;
+    uint8_t max = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
+    if (is_keyboard_left()) {
+        max = k_rgb_matrix_split[0];
+    } else {
+        min = k_rgb_matrix_split[0];
+    }
+#    endif
+
+    // Every frame, not just changed ones, as the carried error moves the output on its own
+    for (uint8_t i = min; i < max; i++) {
+        uint8_t red   = dither(levels[0][target[i].r], &error[i][0]);
+        uint8_t green = dither(levels[1][target[i].g], &error[i][1]);
+        uint8_t blue  = dither(levels[2][target[i].b], &error[i][2]);
+        rgb_matrix_driver.set_color(i, red, green, blue);
+    }
+
+    rgb_matrix_driver.flush();
+}
+
+#endif // RGB_MATRIX_CORRECTION
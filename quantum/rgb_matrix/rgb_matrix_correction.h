@@ -0,0 +1,57 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * Colour correction between the RGB matrix and the LED driver.
+ *
+ * With RGB_MATRIX_CORRECTION defined, every colour sent to the driver is first
+ * looked up in a per-channel table that maps the 8-bit value an effect asked
+ * for to a 16-bit LED level, applying the lightness curve and white balance.
+ * The part of that level that does not fit in the driver's 8 bits is carried
+ * over to the next frame in a one byte per channel error buffer, so a value
+ * between two PWM steps is shown by alternating between them. Slow fades at
+ * low brightness then move smoothly instead of in visible steps.
+ *
+ * The stage replaces the CIE curve in hsv_to_rgb() for the matrix, and costs
+ * 1.5 KB of RAM for the tables plus 6 bytes per LED.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef RGB_MATRIX_CORRECTION
+
+#    ifdef __AVR__
+#        error "RGB_MATRIX_CORRECTION is not supported on AVR, its tables alone take 1.5 KB of RAM"
+#    endif
+
+// 0 selects the CIE 1931 lightness curve, anything else is used as a power law gamma
+#    ifndef RGB_MATRIX_GAMMA
+#        define RGB_MATRIX_GAMMA 0
+#    endif
+#    ifndef RGB_MATRIX_GAMMA_RED
+#        define RGB_MATRIX_GAMMA_RED RGB_MATRIX_GAMMA
+#    endif
+#    ifndef RGB_MATRIX_GAMMA_GREEN
+#        define RGB_MATRIX_GAMMA_GREEN RGB_MATRIX_GAMMA
+#    endif
+#    ifndef RGB_MATRIX_GAMMA_BLUE
+#        define RGB_MATRIX_GAMMA_BLUE RGB_MATRIX_GAMMA
+#    endif
+
+// Full scale of each channel, to even out LEDs whose white is tinted
+#    ifndef RGB_MATRIX_WHITE_BALANCE
+#        define RGB_MATRIX_WHITE_BALANCE {255, 255, 255}
+#    endif
+
+void rgb_matrix_correction_set_white_balance(uint8_t red, uint8_t green, uint8_t blue);
+
+// Used by the RGB matrix core
+void rgb_matrix_correction_init(void);
+void rgb_matrix_correction_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_correction_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_correction_flush(void);
+
+#endif // RGB_MATRIX_CORRECTION
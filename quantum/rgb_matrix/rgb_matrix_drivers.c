@@ -20,10 +20,12 @@
 #include "keyboard.h"
 #include "color.h"
 #include "util.h"
+#include "led/led_shutdown.h"
 
 /* Each driver needs to define the struct
  *    const rgb_matrix_driver_t rgb_matrix_driver;
- * All members must be provided.
+ * All members must be provided, except shutdown and exit_shutdown which may
+ * be left NULL if the hardware has no low power state.
  * Keyboard custom drivers can define this in their own files, it should only
  * be here if shared between boards.
  */
@@ -34,110 +36,176 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3218_update_pwm_buffers,
     .set_color     = is31fl3218_set_color,
     .set_color_all = is31fl3218_set_color_all,
+    .shutdown      = is31fl3218_sw_shutdown,
+    .exit_shutdown = is31fl3218_sw_return_normal,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3236)
+LED_SHUTDOWN_DRIVERS(is31fl3236, IS31FL3236_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3236_init_drivers,
     .flush         = is31fl3236_flush,
     .set_color     = is31fl3236_set_color,
     .set_color_all = is31fl3236_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3729)
+LED_SHUTDOWN_DRIVERS(is31fl3729, IS31FL3729_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3729_init_drivers,
     .flush         = is31fl3729_flush,
     .set_color     = is31fl3729_set_color,
     .set_color_all = is31fl3729_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3731)
+LED_SHUTDOWN_DRIVERS(is31fl3731, IS31FL3731_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3731_init_drivers,
     .flush         = is31fl3731_flush,
     .set_color     = is31fl3731_set_color,
     .set_color_all = is31fl3731_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3733)
+LED_SHUTDOWN_DRIVERS(is31fl3733, IS31FL3733_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3733_init_drivers,
     .flush         = is31fl3733_flush,
     .set_color     = is31fl3733_set_color,
     .set_color_all = is31fl3733_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3736)
+LED_SHUTDOWN_DRIVERS(is31fl3736, IS31FL3736_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3736_init_drivers,
     .flush         = is31fl3736_flush,
     .set_color     = is31fl3736_set_color,
     .set_color_all = is31fl3736_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3737)
+LED_SHUTDOWN_DRIVERS(is31fl3737, IS31FL3737_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3737_init_drivers,
     .flush         = is31fl3737_flush,
     .set_color     = is31fl3737_set_color,
     .set_color_all = is31fl3737_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3741)
+LED_SHUTDOWN_DRIVERS(is31fl3741, IS31FL3741_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3741_init_drivers,
     .flush         = is31fl3741_flush,
     .set_color     = is31fl3741_set_color,
     .set_color_all = is31fl3741_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3742A)
+LED_SHUTDOWN_DRIVERS(is31fl3742a, IS31FL3742A_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3742a_init_drivers,
     .flush         = is31fl3742a_flush,
     .set_color     = is31fl3742a_set_color,
     .set_color_all = is31fl3742a_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3743A)
+LED_SHUTDOWN_DRIVERS(is31fl3743a, IS31FL3743A_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3743a_init_drivers,
     .flush         = is31fl3743a_flush,
     .set_color     = is31fl3743a_set_color,
     .set_color_all = is31fl3743a_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3745)
+LED_SHUTDOWN_DRIVERS(is31fl3745, IS31FL3745_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3745_init_drivers,
     .flush         = is31fl3745_flush,
     .set_color     = is31fl3745_set_color,
     .set_color_all = is31fl3745_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3746A)
+LED_SHUTDOWN_DRIVERS(is31fl3746a, IS31FL3746A_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3746a_init_drivers,
     .flush         = is31fl3746a_flush,
     .set_color     = is31fl3746a_set_color,
     .set_color_all = is31fl3746a_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_SNLED27351)
+LED_SHUTDOWN_DRIVERS(snled27351, SNLED27351_DRIVER_COUNT)
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = snled27351_init_drivers,
     .flush         = snled27351_flush,
     .set_color     = snled27351_set_color,
     .set_color_all = snled27351_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_AW20216S)
+static void shutdown_drivers(void) {
+    aw20216s_sw_shutdown(AW20216S_CS_PIN_1);
+#    if defined(AW20216S_CS_PIN_2)
+    aw20216s_sw_shutdown(AW20216S_CS_PIN_2);
+#    endif
+}
+
+static void exit_shutdown_drivers(void) {
+    aw20216s_sw_return_normal(AW20216S_CS_PIN_1);
+#    if defined(AW20216S_CS_PIN_2)
+    aw20216s_sw_return_normal(AW20216S_CS_PIN_2);
+#    endif
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = aw20216s_init_drivers,
     .flush         = aw20216s_flush,
     .set_color     = aw20216s_set_color,
     .set_color_all = aw20216s_set_color_all,
+    .shutdown      = shutdown_drivers,
+    .exit_shutdown = exit_shutdown_drivers,
 };
 
 #elif defined(RGB_MATRIX_WS2812)
@@ -46,6 +46,10 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional: put the hardware into its low power state once the LEDs are off. */
+    void (*shutdown)(void);
+    /* Optional: bring the hardware back out of shutdown. */
+    void (*exit_shutdown)(void);
 } rgb_matrix_driver_t;
 
 extern const rgb_matrix_driver_t rgb_matrix_driver;
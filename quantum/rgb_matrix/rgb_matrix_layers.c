@@ -0,0 +1,233 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+#ifdef RGB_MATRIX_LAYERS
+
+#    include <string.h>
+#    include <lib/lib8tion/lib8tion.h>
+#    include "host.h"
+#    ifdef CAPS_WORD_ENABLE
+#        include "caps_word.h"
+#    endif
+
+typedef struct {
+    RGB     color[RGB_MATRIX_LED_COUNT];
+    uint8_t alpha[RGB_MATRIX_LED_COUNT];
+    uint8_t blend;
+    uint8_t opacity;
+    bool    enabled;
+    bool    invalid; // Needs a call to rgb_matrix_layer_render_kb()
+    bool    changed; // Pixels changed since the last composite
+} rgb_matrix_layer_t;
+
+static rgb_matrix_layer_t layers[RGB_MATRIX_LAYERS_COUNT];
+static RGB                base[RGB_MATRIX_LED_COUNT];
+static RGB                output[RGB_MATRIX_LED_COUNT];
+static bool               base_changed   = false;
+static bool               layers_visible = true;
+static bool               layers_shown   = false; // Whether the last composite included the layers
+static bool               caps_active    = false; // Last state of rgb_matrix_layer_caps_active_kb()
+
+static inline bool rgb_equal(RGB a, RGB b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+// x / 255 for x up to 255 * 255, so that full intensity stays at 255
+static inline uint8_t div255(uint16_t x) {
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+static inline uint8_t channel_mul(uint8_t a, uint8_t b) {
+    return div255(a * b);
+}
+
+static inline uint8_t channel_mix(uint8_t a, uint8_t b, uint8_t amount_of_b) {
+    return div255(a * (255 - amount_of_b) + b * amount_of_b);
+}
+
+static inline uint8_t blend_channel(uint8_t blend, uint8_t below, uint8_t above, uint8_t alpha) {
+    switch (blend) {
+        case RGB_MATRIX_BLEND_ADD:
+            return qadd8(below, channel_mul(above, alpha));
+        case RGB_MATRIX_BLEND_MULTIPLY:
+            return channel_mix(below, channel_mul(below, above), alpha);
+        default:
+            return channel_mix(below, above, alpha);
+    }
+}
+
+__attribute__((weak)) bool rgb_matrix_layer_render_kb(uint8_t layer) {
+    return rgb_matrix_layer_render_user(layer);
+}
+
+__attribute__((weak)) bool rgb_matrix_layer_render_user(uint8_t layer) {
+    return false;
+}
+
+__attribute__((weak)) bool rgb_matrix_layer_caps_active_kb(void) {
+    bool active = rgb_matrix_layer_caps_active_user();
+    active |= host_keyboard_led_state().caps_lock;
+#    ifdef CAPS_WORD_ENABLE
+    active |= is_caps_word_on();
+#    endif
+    return active;
+}
+
+__attribute__((weak)) bool rgb_matrix_layer_caps_active_user(void) {
+    return false;
+}
+
+void rgb_matrix_layers_init(void) {
+    memset(layers, 0, sizeof(layers));
+    for (uint8_t i = 0; i < RGB_MATRIX_LAYERS_COUNT; i++) {
+        layers[i].blend   = RGB_MATRIX_BLEND_ALPHA;
+        layers[i].opacity = UINT8_MAX;
+    }
+    memset(base, 0, sizeof(base));
+    memset(output, 0, sizeof(output));
+    base_changed = true;
+    caps_active  = false;
+}
+
+void rgb_matrix_layer_enable(uint8_t layer, bool enable) {
+    if (layer >= RGB_MATRIX_LAYERS_COUNT || layers[layer].enabled == enable) {
+        return;
+    }
+    layers[layer].enabled = enable;
+    layers[layer].changed = true;
+    if (enable) {
+        layers[layer].invalid = true;
+    }
+}
+
+bool rgb_matrix_layer_is_enabled(uint8_t layer) {
+    return layer < RGB_MATRIX_LAYERS_COUNT && layers[layer].enabled;
+}
+
+void rgb_matrix_layer_set_blend(uint8_t layer, rgb_matrix_blend_t blend, uint8_t opacity) {
+    if (layer >= RGB_MATRIX_LAYERS_COUNT) {
+        return;
+    }
+    layers[layer].blend   = blend;
+    layers[layer].opacity = opacity;
+    layers[layer].changed = true;
+}
+
+void rgb_matrix_layer_invalidate(uint8_t layer) {
+    if (layer < RGB_MATRIX_LAYERS_COUNT) {
+        layers[layer].invalid = true;
+    }
+}
+
+void rgb_matrix_layer_clear(uint8_t layer) {
+    if (layer >= RGB_MATRIX_LAYERS_COUNT) {
+        return;
+    }
+    memset(layers[layer].alpha, 0, sizeof(layers[layer].alpha));
+    layers[layer].changed = true;
+}
+
+void rgb_matrix_layer_set_color(uint8_t layer, uint8_t index, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
+    if (layer >= RGB_MATRIX_LAYERS_COUNT || index >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+    rgb_matrix_layer_t *l     = &layers[layer];
+    RGB                 color = {.r = red, .g = green, .b = blue};
+    if (l->alpha[index] == alpha && rgb_equal(l->color[index], color)) {
+        return;
+    }
+    l->color[index] = color;
+    l->alpha[index] = alpha;
+    l->changed      = true;
+}
+
+void rgb_matrix_layers_set_base(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+    RGB color = {.r = red, .g = green, .b = blue};
+    if (!rgb_equal(base[index], color)) {
+        base[index]  = color;
+        base_changed = true;
+    }
+}
+
+void rgb_matrix_layers_set_base_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_matrix_layers_set_base(i, red, green, blue);
+    }
+}
+
+void rgb_matrix_layers_set_visible(bool visible) {
+    layers_visible = visible;
+}
+
+void rgb_matrix_layers_flush(void) {
+    bool changed = base_changed || layers_visible != layers_shown;
+
+#    if RGB_MATRIX_LAYERS_COUNT > RGB_MATRIX_LAYER_CAPS
+    // Only follow changes, so the caps layer can still be shown or hidden by hand in between
+    bool caps = rgb_matrix_layer_caps_active_kb();
+    if (caps != caps_active) {
+        caps_active = caps;
+        rgb_matrix_layer_enable(RGB_MATRIX_LAYER_CAPS, caps);
+    }
+#    endif
+
+    if (layers_visible) {
+        for (uint8_t l = 0; l < RGB_MATRIX_LAYERS_COUNT; l++) {
+            rgb_matrix_layer_t *layer = &layers[l];
+            if (layer->enabled && layer->invalid) {
+                layer->invalid = rgb_matrix_layer_render_kb(l);
+            }
+            changed |= layer->changed;
+            layer->changed = false;
+        }
+    }
+
+    if (changed) {
+        uint8_t min = 0;
+        uint8_t max = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+        const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
+        if (is_keyboard_left()) {
+            max = k_rgb_matrix_split[0];
+        } else {
+            min = k_rgb_matrix_split[0];
+        }
+#    endif
+        for (uint8_t i = min; i < max; i++) {
+            RGB color = base[i];
+            for (uint8_t l = 0; layers_visible && l < RGB_MATRIX_LAYERS_COUNT; l++) {
+                const rgb_matrix_layer_t *layer = &layers[l];
+                uint8_t                   alpha = channel_mul(layer->alpha[i], layer->opacity);
+                if (!layer->enabled || alpha == 0) {
+                    continue;
+                }
+                color.r = blend_channel(layer->blend, color.r, layer->color[i].r, alpha);
+                color.g = blend_channel(layer->blend, color.g, layer->color[i].g, alpha);
+                color.b = blend_channel(layer->blend, color.b, layer->color[i].b, alpha);
+            }
+            if (!rgb_equal(output[i], color)) {
+                output[i] = color;
+#    ifdef RGB_MATRIX_CORRECTION
+                rgb_matrix_correction_set_color(i, color.r, color.g, color.b);
+#    else
+                rgb_matrix_driver.set_color(i, color.r, color.g, color.b);
+#    endif
+            }
+        }
+        base_changed = false;
+        layers_shown = layers_visible;
+    }
+
+#    ifdef RGB_MATRIX_CORRECTION
+    rgb_matrix_correction_flush();
+#    else
+    rgb_matrix_driver.flush();
+#    endif
+}
+
+#endif // RGB_MATRIX_LAYERS
@@ -0,0 +1,65 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * Lighting layers composited over the current RGB matrix effect.
+ *
+ * With RGB_MATRIX_LAYERS defined, the effect and the indicator callbacks
+ * render into a base buffer instead of the driver. Each frame the enabled
+ * layers are blended over it, bottom to top, and only LEDs whose final colour
+ * changed are passed on to the driver.
+ *
+ * A layer keeps its pixels between frames. It is only redrawn, through
+ * rgb_matrix_layer_render_kb()/_user(), after rgb_matrix_layer_invalidate()
+ * or if its last render asked to be called again, so static indicators cost
+ * nothing once drawn.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef RGB_MATRIX_LAYERS
+
+#    ifndef RGB_MATRIX_LAYERS_COUNT
+#        define RGB_MATRIX_LAYERS_COUNT 3
+#    endif
+
+// Suggested use of the default stack, from the bottom up
+enum rgb_matrix_layer_ids {
+    RGB_MATRIX_LAYER_REACTIVE,
+    RGB_MATRIX_LAYER_INDICATOR,
+    RGB_MATRIX_LAYER_CAPS,
+};
+
+typedef enum rgb_matrix_blend_t {
+    RGB_MATRIX_BLEND_ALPHA,    // Mix towards the layer colour by its alpha
+    RGB_MATRIX_BLEND_ADD,      // Add the layer colour, scaled by its alpha
+    RGB_MATRIX_BLEND_MULTIPLY, // Darken by the layer colour, scaled by its alpha
+} rgb_matrix_blend_t;
+
+void rgb_matrix_layer_enable(uint8_t layer, bool enable);
+bool rgb_matrix_layer_is_enabled(uint8_t layer);
+void rgb_matrix_layer_set_blend(uint8_t layer, rgb_matrix_blend_t blend, uint8_t opacity);
+void rgb_matrix_layer_invalidate(uint8_t layer);
+void rgb_matrix_layer_clear(uint8_t layer);
+void rgb_matrix_layer_set_color(uint8_t layer, uint8_t index, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
+
+// Redraw an invalidated layer, return true to be called again next frame
+bool rgb_matrix_layer_render_kb(uint8_t layer);
+bool rgb_matrix_layer_render_user(uint8_t layer);
+
+// Whether RGB_MATRIX_LAYER_CAPS should be shown: Caps Lock, Caps Word or the user hook.
+// The layer is enabled and disabled whenever this changes.
+bool rgb_matrix_layer_caps_active_kb(void);
+bool rgb_matrix_layer_caps_active_user(void);
+
+// Used by the RGB matrix core
+void rgb_matrix_layers_init(void);
+void rgb_matrix_layers_set_base(int index, uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_layers_set_base_all(uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_layers_set_visible(bool visible);
+void rgb_matrix_layers_flush(void);
+
+#endif // RGB_MATRIX_LAYERS
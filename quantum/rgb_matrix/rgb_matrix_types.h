@@ -73,6 +73,19 @@ typedef struct PACKED {
     uint8_t     flags[RGB_MATRIX_LED_COUNT];
 } led_config_t;
 
+typedef struct {
+    int16_t dx;    // g_led_config.point[i].x - k_rgb_matrix_center.x
+    int16_t dy;    // g_led_config.point[i].y - k_rgb_matrix_center.y
+    uint8_t dist;  // sqrt16(dx * dx + dy * dy)
+    uint8_t angle; // atan2_8(dy, dx)
+} led_geometry_t;
+
+typedef struct {
+    uint8_t row;  // Matrix position of the neighbouring key
+    uint8_t col;
+    uint8_t dist; // Distance between the two keys' LEDs
+} led_neighbour_t;
+
 typedef union {
     uint64_t raw;
     struct PACKED {
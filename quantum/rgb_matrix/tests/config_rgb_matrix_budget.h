@@ -0,0 +1,19 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "config_rgb_matrix_render.h"
+
+#include <stdint.h>
+
+#define RGB_MATRIX_RENDER_BUDGET_US 500
+
+// A render clock the test controls, so each LED can be made to cost a known number of ticks
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t rgb_matrix_test_clock(void);
+#ifdef __cplusplus
+}
+#endif
+#define RGB_MATRIX_RENDER_CLOCK() rgb_matrix_test_clock()
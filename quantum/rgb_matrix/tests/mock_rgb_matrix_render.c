@@ -0,0 +1,48 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "rgb_matrix.h"
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+// Nothing is persisted between runs, so every run starts from the RGB matrix defaults
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    memset(buf, 0, len);
+}
+
+void eeprom_update_block(const void *buf, void *addr, size_t len) {}
+
+// A 5x12 grid with one LED per key. The outer columns and the bottom row are
+// modifiers, and the home row keys other than the inner columns are flagged as
+// indicators, which is how the fingerpunch boards mark them.
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11 },
+        { 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23 },
+        { 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35 },
+        { 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47 },
+        { 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59 }
+    }, {
+        {  0,  0}, { 20,  0}, { 40,  0}, { 61,  0}, { 81,  0}, {101,  0}, {122,  0}, {142,  0}, {162,  0}, {183,  0}, {203,  0}, {224,  0},
+        {  0, 16}, { 20, 16}, { 40, 16}, { 61, 16}, { 81, 16}, {101, 16}, {122, 16}, {142, 16}, {162, 16}, {183, 16}, {203, 16}, {224, 16},
+        {  0, 32}, { 20, 32}, { 40, 32}, { 61, 32}, { 81, 32}, {101, 32}, {122, 32}, {142, 32}, {162, 32}, {183, 32}, {203, 32}, {224, 32},
+        {  0, 48}, { 20, 48}, { 40, 48}, { 61, 48}, { 81, 48}, {101, 48}, {122, 48}, {142, 48}, {162, 48}, {183, 48}, {203, 48}, {224, 48},
+        {  0, 64}, { 20, 64}, { 40, 64}, { 61, 64}, { 81, 64}, {101, 64}, {122, 64}, {142, 64}, {162, 64}, {183, 64}, {203, 64}, {224, 64}
+    }, {
+         1,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  1,
+         1,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  1,
+         1, 12, 12, 12, 12,  4,  4, 12, 12, 12, 12,  1,
+         1,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  1,
+         1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1
+    }
+};
+// clang-format on
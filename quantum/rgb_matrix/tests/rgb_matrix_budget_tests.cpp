@@ -0,0 +1,115 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix_virtual.h"
+#include "rgb_matrix.h"
+#include "timer.h"
+}
+
+extern "C" {
+void     advance_time(uint32_t ms);
+void     simulate_async_tick(uint32_t t);
+uint32_t timer_read_internal(void);
+}
+
+// The render clock runs at 1000 ticks per millisecond, and every LED in the pass being rendered costs this many ticks
+static uint32_t cost_per_led = 0;
+static uint32_t render_ticks = 0;
+static uint8_t  frame_calls  = 0;
+static uint8_t  largest_pass = 0;
+static uint32_t passes       = 0;
+
+extern "C" uint32_t rgb_matrix_test_clock(void) {
+    // Called once before and once after each pass, so the pass is charged on the second call
+    struct rgb_matrix_limits_t limits = rgb_matrix_get_limits(frame_calls++ / 2);
+    uint8_t                    count  = limits.led_max_index - limits.led_min_index;
+    render_ticks += cost_per_led * count;
+    if (count > largest_pass) {
+        largest_pass = count;
+    }
+    passes++;
+    // Rendering takes time, so the millisecond timer the clock is calibrated against moves on with it
+    advance_time(render_ticks / 1000);
+    render_ticks %= 1000;
+    return timer_read_internal() * 1000 + render_ticks;
+}
+
+class RgbMatrixBudget : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_clear();
+        cost_per_led = 0;
+        render_ticks = 0;
+        rgb_matrix_virtual_reset();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    }
+
+    bool render_frame() {
+        rgb_matrix_virtual_stats_t before, after;
+        rgb_matrix_virtual_get_stats(&before);
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        frame_calls = 0;
+        for (int i = 0; i < RGB_MATRIX_LED_COUNT + 8; ++i) {
+            rgb_matrix_task();
+            rgb_matrix_virtual_get_stats(&after);
+            if (after.flushes != before.flushes) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Render until the per-LED cost estimate has settled, then report the largest pass of one more frame
+    uint8_t settled_pass_size(void) {
+        for (int frame = 0; frame < 50; ++frame) {
+            EXPECT_TRUE(render_frame());
+        }
+        largest_pass = 0;
+        EXPECT_TRUE(render_frame());
+        return largest_pass;
+    }
+};
+
+TEST_F(RgbMatrixBudget, PassSizeFollowsMeasuredCost) {
+    // 500us budget at 10us per LED
+    cost_per_led = 10;
+    EXPECT_NEAR(settled_pass_size(), 50, 1);
+
+    // The effect got more expensive, so passes shrink
+    cost_per_led = 100;
+    EXPECT_NEAR(settled_pass_size(), 5, 1);
+
+    // And grow again once it is cheap
+    cost_per_led = 25;
+    EXPECT_NEAR(settled_pass_size(), 20, 1);
+}
+
+TEST_F(RgbMatrixBudget, FrameIsStillRenderedWhole) {
+    cost_per_led = 100;
+    settled_pass_size();
+
+    rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    passes = 0;
+    ASSERT_TRUE(render_frame());
+    // Two clock reads per pass, and every LED has to have been covered by one of them
+    EXPECT_GE(passes / 2, (uint32_t)(RGB_MATRIX_LED_COUNT / 6));
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) {
+        RGB rgb = rgb_matrix_virtual_get_color(i);
+        EXPECT_EQ(rgb.r, 255) << "LED " << (int)i;
+    }
+}
+
+TEST_F(RgbMatrixBudget, InitDoesNotWaitForTheClock) {
+    // Each timer read moves time on by 1ms, so any waiting on the timer would show up here
+    simulate_async_tick(1);
+    uint32_t start = timer_read_internal();
+    rgb_matrix_init();
+    uint32_t elapsed = timer_read_internal() - start;
+    simulate_async_tick(0);
+    EXPECT_LT(elapsed, 2);
+}
@@ -0,0 +1,126 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <math.h>
+
+extern "C" {
+#include "rgb_matrix_virtual.h"
+#include "rgb_matrix.h"
+#include "timer.h"
+}
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+// The dither error wraps every 256 frames, so the output summed over that many frames is the exact table level
+#define DITHER_PERIOD 256
+
+class RgbMatrixCorrection : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_clear();
+        rgb_matrix_virtual_reset();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    }
+
+    bool render_frame() {
+        rgb_matrix_virtual_stats_t before, after;
+        rgb_matrix_virtual_get_stats(&before);
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        for (int i = 0; i < RGB_MATRIX_LED_COUNT + 8; ++i) {
+            rgb_matrix_task();
+            rgb_matrix_virtual_get_stats(&after);
+            if (after.flushes != before.flushes) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Sum of each channel of one LED over a full dither period
+    RGB sum_over_period(uint8_t index, uint32_t sum[3], bool *alternates = NULL) {
+        RGB first = {0, 0, 0};
+        sum[0] = sum[1] = sum[2] = 0;
+        if (alternates) *alternates = false;
+        for (int f = 0; f < DITHER_PERIOD; ++f) {
+            EXPECT_TRUE(render_frame());
+            RGB rgb = rgb_matrix_virtual_get_color(index);
+            if (f == 0) {
+                first = rgb;
+            } else if (alternates && rgb.r != first.r) {
+                *alternates = true;
+            }
+            sum[0] += rgb.r;
+            sum[1] += rgb.g;
+            sum[2] += rgb.b;
+        }
+        return first;
+    }
+};
+
+static uint32_t cie_level(uint8_t value) {
+    float l = value / 255.0f;
+    float y = l <= 0.08f ? l * (100.0f / 903.3f) : powf((l + 0.16f) / 1.16f, 3);
+    return (uint32_t)(y * (255 << 8) + 0.5f);
+}
+
+TEST_F(RgbMatrixCorrection, BlackAndWhiteAreExact) {
+    uint32_t sum[3];
+
+    rgb_matrix_sethsv_noeeprom(0, 0, 255);
+    ASSERT_TRUE(render_frame());
+    sum_over_period(10, sum);
+    EXPECT_EQ(sum[0], 255 * DITHER_PERIOD);
+    EXPECT_EQ(sum[1], 255 * DITHER_PERIOD);
+    EXPECT_EQ(sum[2], 255 * DITHER_PERIOD);
+
+    rgb_matrix_sethsv_noeeprom(0, 0, 0);
+    ASSERT_TRUE(render_frame());
+    sum_over_period(10, sum);
+    EXPECT_EQ(sum[0], 0);
+    EXPECT_EQ(sum[1], 0);
+    EXPECT_EQ(sum[2], 0);
+}
+
+TEST_F(RgbMatrixCorrection, DitheredAverageMatchesCurve) {
+    for (uint8_t value : {8, 20, 40, 100, 200}) {
+        rgb_matrix_sethsv_noeeprom(0, 0, value);
+        ASSERT_TRUE(render_frame());
+
+        uint32_t sum[3];
+        for (uint8_t index : {0, 17, RGB_MATRIX_LED_COUNT - 1}) {
+            sum_over_period(index, sum);
+            EXPECT_EQ(sum[0], cie_level(value)) << "value " << (int)value << " LED " << (int)index;
+            EXPECT_EQ(sum[1], sum[0]);
+            EXPECT_EQ(sum[2], sum[0]);
+        }
+    }
+}
+
+TEST_F(RgbMatrixCorrection, LowValuesAlternateBetweenSteps) {
+    // Without dithering this would be stuck at 1 out of 255
+    rgb_matrix_sethsv_noeeprom(0, 0, 20);
+    ASSERT_TRUE(render_frame());
+
+    uint32_t sum[3];
+    bool     alternates;
+    sum_over_period(3, sum, &alternates);
+    EXPECT_TRUE(alternates);
+    EXPECT_GT(sum[0] % DITHER_PERIOD, 0);
+}
+
+TEST_F(RgbMatrixCorrection, WhiteBalanceScalesChannels) {
+    rgb_matrix_correction_set_white_balance(255, 128, 64);
+    rgb_matrix_sethsv_noeeprom(0, 0, 255);
+    ASSERT_TRUE(render_frame());
+
+    uint32_t sum[3];
+    sum_over_period(5, sum);
+    EXPECT_EQ(sum[0], 255 * DITHER_PERIOD);
+    EXPECT_EQ(sum[1], 128 * DITHER_PERIOD);
+    EXPECT_EQ(sum[2], 64 * DITHER_PERIOD);
+}
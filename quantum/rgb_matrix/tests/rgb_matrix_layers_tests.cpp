@@ -0,0 +1,199 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix_virtual.h"
+#include "rgb_matrix.h"
+#include "host.h"
+#include "timer.h"
+}
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+static uint32_t render_calls[RGB_MATRIX_LAYERS_COUNT];
+static bool     keep_rendering = false;
+static led_t    host_leds      = {0};
+static bool     user_caps      = false;
+
+extern "C" led_t host_keyboard_led_state(void) {
+    return host_leds;
+}
+
+extern "C" bool rgb_matrix_layer_caps_active_user(void) {
+    return user_caps;
+}
+
+extern "C" bool rgb_matrix_layer_render_user(uint8_t layer) {
+    render_calls[layer]++;
+    rgb_matrix_layer_set_color(layer, 5, 0, 0, 255, 255);
+    return keep_rendering;
+}
+
+class RgbMatrixLayers : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_clear();
+        rgb_matrix_virtual_reset();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        memset(render_calls, 0, sizeof(render_calls));
+        keep_rendering = false;
+        host_leds.raw  = 0;
+        user_caps      = false;
+    }
+
+    bool render_frame() {
+        rgb_matrix_virtual_stats_t before, after;
+        rgb_matrix_virtual_get_stats(&before);
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        for (int i = 0; i < RGB_MATRIX_LED_COUNT + 8; ++i) {
+            rgb_matrix_task();
+            rgb_matrix_virtual_get_stats(&after);
+            if (after.flushes != before.flushes) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t driver_writes() {
+        rgb_matrix_virtual_stats_t stats;
+        rgb_matrix_virtual_get_stats(&stats);
+        return stats.set_color_calls + stats.set_color_all_calls;
+    }
+};
+
+#define EXPECT_LED(i, red, green, blue)                \
+    do {                                               \
+        RGB rgb = rgb_matrix_virtual_get_color(i);     \
+        EXPECT_EQ(rgb.r, red) << "LED " << (int)(i);   \
+        EXPECT_EQ(rgb.g, green) << "LED " << (int)(i); \
+        EXPECT_EQ(rgb.b, blue) << "LED " << (int)(i);  \
+    } while (0)
+
+TEST_F(RgbMatrixLayers, OpaqueLayerCoversEffect) {
+    rgb_matrix_layer_enable(RGB_MATRIX_LAYER_INDICATOR, true);
+    ASSERT_TRUE(render_frame());
+
+    EXPECT_LED(4, 255, 0, 0);
+    EXPECT_LED(5, 0, 0, 255);
+    EXPECT_LED(6, 255, 0, 0);
+}
+
+TEST_F(RgbMatrixLayers, BlendModes) {
+    rgb_matrix_layer_set_color(RGB_MATRIX_LAYER_REACTIVE, 1, 0, 0, 255, 128);
+    rgb_matrix_layer_set_color(RGB_MATRIX_LAYER_CAPS, 2, 0, 255, 0, 255);
+    rgb_matrix_layer_set_blend(RGB_MATRIX_LAYER_CAPS, RGB_MATRIX_BLEND_ADD, 255);
+    rgb_matrix_layer_set_color(RGB_MATRIX_LAYER_INDICATOR, 3, 0, 0, 0, 255);
+    rgb_matrix_layer_set_blend(RGB_MATRIX_LAYER_INDICATOR, RGB_MATRIX_BLEND_MULTIPLY, 128);
+    rgb_matrix_layer_enable(RGB_MATRIX_LAYER_REACTIVE, true);
+    rgb_matrix_layer_enable(RGB_MATRIX_LAYER_CAPS, true);
+    rgb_matrix_layer_enable(RGB_MATRIX_LAYER_INDICATOR, true);
+    ASSERT_TRUE(render_frame());
+
+    RGB half = rgb_matrix_virtual_get_color(1);
+    EXPECT_NEAR(half.r, 127, 1);
+    EXPECT_NEAR(half.b, 128, 1);
+    EXPECT_LED(2, 255, 255, 0);
+    RGB dim = rgb_matrix_virtual_get_color(3);
+    EXPECT_NEAR(dim.r, 127, 1);
+}
+
+TEST_F(RgbMatrixLayers, LayersOnlyRenderWhenInvalidated) {
+    rgb_matrix_layer_enable(RGB_MATRIX_LAYER_CAPS, true);
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(render_frame());
+    }
+    EXPECT_EQ(render_calls[RGB_MATRIX_LAYER_CAPS], 1);
+
+    rgb_matrix_layer_invalidate(RGB_MATRIX_LAYER_CAPS);
+    ASSERT_TRUE(render_frame());
+    EXPECT_EQ(render_calls[RGB_MATRIX_LAYER_CAPS], 2);
+
+    keep_rendering = true;
+    rgb_matrix_layer_invalidate(RGB_MATRIX_LAYER_CAPS);
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(render_frame());
+    }
+    EXPECT_EQ(render_calls[RGB_MATRIX_LAYER_CAPS], 7);
+    EXPECT_EQ(render_calls[RGB_MATRIX_LAYER_REACTIVE], 0);
+}
+
+TEST_F(RgbMatrixLayers, UnchangedFramesSkipTheDriver) {
+    rgb_matrix_layer_enable(RGB_MATRIX_LAYER_INDICATOR, true);
+    ASSERT_TRUE(render_frame());
+    ASSERT_TRUE(render_frame());
+
+    uint32_t writes = driver_writes();
+    ASSERT_TRUE(render_frame());
+    EXPECT_EQ(driver_writes(), writes);
+
+    rgb_matrix_layer_set_color(RGB_MATRIX_LAYER_INDICATOR, 7, 0, 255, 0, 255);
+    ASSERT_TRUE(render_frame());
+    EXPECT_EQ(driver_writes(), writes + 1);
+    EXPECT_LED(7, 0, 255, 0);
+}
+
+TEST_F(RgbMatrixLayers, LayersHiddenWhileDisabled) {
+    rgb_matrix_layer_enable(RGB_MATRIX_LAYER_INDICATOR, true);
+    ASSERT_TRUE(render_frame());
+    EXPECT_LED(5, 0, 0, 255);
+
+    rgb_matrix_disable_noeeprom();
+    ASSERT_TRUE(render_frame());
+    EXPECT_LED(5, 0, 0, 0);
+
+    rgb_matrix_enable_noeeprom();
+    ASSERT_TRUE(render_frame());
+    EXPECT_LED(5, 0, 0, 255);
+}
+
+TEST_F(RgbMatrixLayers, CapsLayerFollowsCapsLock) {
+    ASSERT_TRUE(render_frame());
+    EXPECT_FALSE(rgb_matrix_layer_is_enabled(RGB_MATRIX_LAYER_CAPS));
+    EXPECT_LED(5, 255, 0, 0);
+
+    host_leds.caps_lock = true;
+    ASSERT_TRUE(render_frame());
+    EXPECT_TRUE(rgb_matrix_layer_is_enabled(RGB_MATRIX_LAYER_CAPS));
+    EXPECT_EQ(render_calls[RGB_MATRIX_LAYER_CAPS], 1);
+    EXPECT_LED(5, 0, 0, 255);
+
+    // Hiding it by hand sticks until Caps Lock changes again
+    rgb_matrix_layer_enable(RGB_MATRIX_LAYER_CAPS, false);
+    ASSERT_TRUE(render_frame());
+    EXPECT_LED(5, 255, 0, 0);
+
+    host_leds.caps_lock = false;
+    ASSERT_TRUE(render_frame());
+    host_leds.caps_lock = true;
+    ASSERT_TRUE(render_frame());
+    EXPECT_LED(5, 0, 0, 255);
+
+    host_leds.caps_lock = false;
+    ASSERT_TRUE(render_frame());
+    EXPECT_FALSE(rgb_matrix_layer_is_enabled(RGB_MATRIX_LAYER_CAPS));
+    EXPECT_LED(5, 255, 0, 0);
+}
+
+TEST_F(RgbMatrixLayers, CapsLayerFollowsUserHook) {
+    user_caps = true;
+    ASSERT_TRUE(render_frame());
+    EXPECT_TRUE(rgb_matrix_layer_is_enabled(RGB_MATRIX_LAYER_CAPS));
+
+    // Caps Lock still shows the layer on its own
+    user_caps           = false;
+    host_leds.caps_lock = true;
+    ASSERT_TRUE(render_frame());
+    EXPECT_TRUE(rgb_matrix_layer_is_enabled(RGB_MATRIX_LAYER_CAPS));
+
+    host_leds.caps_lock = false;
+    ASSERT_TRUE(render_frame());
+    EXPECT_FALSE(rgb_matrix_layer_is_enabled(RGB_MATRIX_LAYER_CAPS));
+}
@@ -0,0 +1,353 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+
+extern "C" {
+#include "rgb_matrix_virtual.h"
+#include "rgb_matrix.h"
+#include "led_tables.h"
+#include "timer.h"
+}
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+/*
+ * Renders every effect compiled into the test against the virtual driver and
+ * reports how long a frame of each one takes. The following environment
+ * variables control a run:
+ *
+ *   RGB_MATRIX_RENDER_FRAMES    Frames to render per effect (default 200)
+ *   RGB_MATRIX_RENDER_DUMP_DIR  Write every frame as <dir>/<mode>_<effect>_<frame>.ppm
+ */
+
+#define DEFAULT_FRAMES 200
+#define KEYPRESS_INTERVAL 10 // Frames between synthetic keypresses
+#define MAX_TASK_CALLS (RGB_MATRIX_LED_COUNT + 8)
+#define DUMP_SCALE 2
+
+typedef struct {
+    uint8_t     mode;
+    const char *name;
+} effect_t;
+
+static const effect_t effects[] = {
+#define RGB_MATRIX_EFFECT(name, ...) {RGB_MATRIX_##name, #name},
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+#define RGB_MATRIX_EFFECT(name, ...) {RGB_MATRIX_CUSTOM_##name, #name},
+#include "rgb_matrix_kb.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+typedef struct {
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t total_cycles;
+    uint32_t set_color_calls;
+    uint32_t frames;
+} frame_cost_t;
+
+static uint64_t read_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+class RgbMatrixRender : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_clear();
+        srand(1);
+        rgb_matrix_virtual_reset();
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+    }
+
+    // Run the RGB matrix task until the driver is flushed, i.e. one whole frame
+    bool render_frame(frame_cost_t *cost = NULL) {
+        rgb_matrix_virtual_stats_t before, after;
+        rgb_matrix_virtual_get_stats(&before);
+
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        auto     start        = std::chrono::steady_clock::now();
+        uint64_t start_cycles = read_cycles();
+        for (int i = 0; i < MAX_TASK_CALLS; ++i) {
+            rgb_matrix_task();
+            rgb_matrix_virtual_get_stats(&after);
+            if (after.flushes != before.flushes) {
+                break;
+            }
+        }
+        uint64_t cycles = read_cycles() - start_cycles;
+        uint64_t ns     = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        if (after.flushes == before.flushes) {
+            return false;
+        }
+        if (cost) {
+            cost->total_ns += ns;
+            cost->total_cycles += cycles;
+            cost->max_ns = ns > cost->max_ns ? ns : cost->max_ns;
+            cost->set_color_calls += after.set_color_calls - before.set_color_calls;
+            cost->frames++;
+        }
+        return true;
+    }
+};
+
+TEST_F(RgbMatrixRender, SolidColorReachesDriver) {
+    rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    ASSERT_TRUE(render_frame());
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) {
+        RGB rgb = rgb_matrix_virtual_get_color(i);
+        EXPECT_EQ(rgb.r, 255) << "LED " << (int)i;
+        EXPECT_EQ(rgb.g, 0) << "LED " << (int)i;
+        EXPECT_EQ(rgb.b, 0) << "LED " << (int)i;
+    }
+}
+
+TEST_F(RgbMatrixRender, KeypressLightsReactiveEffect) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    ASSERT_TRUE(render_frame());
+
+    rgb_matrix_handle_key_event(2, 3, true);
+    ASSERT_TRUE(render_frame());
+    ASSERT_TRUE(render_frame());
+
+    RGB pressed = rgb_matrix_virtual_get_color(g_led_config.matrix_co[2][3]);
+    RGB idle    = rgb_matrix_virtual_get_color(g_led_config.matrix_co[0][0]);
+    EXPECT_GT(pressed.r + pressed.g + pressed.b, idle.r + idle.g + idle.b);
+}
+
+TEST_F(RgbMatrixRender, HeatmapDecaysOnlyActiveCells) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+    ASSERT_TRUE(render_frame());
+
+    rgb_matrix_handle_key_event(2, 3, true);
+    EXPECT_TRUE(g_rgb_frame_buffer_active[2] & (MATRIX_ROW_SHIFTER << 3));
+    EXPECT_FALSE(g_rgb_frame_buffer_active[4] & (MATRIX_ROW_SHIFTER << 11));
+
+    bool empty = false;
+    for (int frame = 0; frame < 200 && !empty; ++frame) {
+        ASSERT_TRUE(render_frame());
+        empty = true;
+        for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+            for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+                bool active = g_rgb_frame_buffer_active[row] & (MATRIX_ROW_SHIFTER << col);
+                ASSERT_EQ(active, g_rgb_frame_buffer[row][col] != 0) << (int)row << "," << (int)col;
+            }
+            empty &= g_rgb_frame_buffer_active[row] == 0;
+        }
+    }
+    EXPECT_TRUE(empty);
+
+    ASSERT_TRUE(render_frame());
+    RGB rgb = rgb_matrix_virtual_get_color(g_led_config.matrix_co[2][3]);
+    EXPECT_EQ(rgb.r + rgb.g + rgb.b, 0);
+}
+
+// hsv_to_rgb() as it was before the batched conversion, kept as the reference
+// both conversions have to match
+static RGB reference_hsv_to_rgb(HSV hsv, bool use_cie) {
+    RGB      rgb;
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h, s, v;
+
+    h = hsv.h;
+    s = hsv.s;
+#ifdef USE_CIE1931_CURVE
+    v = use_cie ? pgm_read_byte(&CIE1931_CURVE[hsv.v]) : hsv.v;
+#else
+    (void)use_cie;
+    v = hsv.v;
+#endif
+
+    if (s == 0) {
+        rgb.r = rgb.g = rgb.b = v;
+        return rgb;
+    }
+
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            rgb.r = v;
+            rgb.g = t;
+            rgb.b = p;
+            break;
+        case 1:
+            rgb.r = q;
+            rgb.g = v;
+            rgb.b = p;
+            break;
+        case 2:
+            rgb.r = p;
+            rgb.g = v;
+            rgb.b = t;
+            break;
+        case 3:
+            rgb.r = p;
+            rgb.g = q;
+            rgb.b = v;
+            break;
+        case 4:
+            rgb.r = t;
+            rgb.g = p;
+            rgb.b = v;
+            break;
+        default:
+            rgb.r = v;
+            rgb.g = p;
+            rgb.b = q;
+            break;
+    }
+
+    return rgb;
+}
+
+static ::testing::AssertionResult rgb_matches(const char *what, HSV hsv, RGB actual, RGB expected) {
+    if (actual.r == expected.r && actual.g == expected.g && actual.b == expected.b) {
+        return ::testing::AssertionSuccess();
+    }
+    return ::testing::AssertionFailure() << what << "(" << (int)hsv.h << "," << (int)hsv.s << "," << (int)hsv.v << ") = " << (int)actual.r << "," << (int)actual.g << "," << (int)actual.b << ", expected " << (int)expected.r << "," << (int)expected.g << "," << (int)expected.b;
+}
+
+TEST_F(RgbMatrixRender, BatchedConversionMatchesSingle) {
+    HSV hsv[256];
+    RGB rgb[256], rgb_nocie[256];
+
+    for (uint16_t v = 0; v < 256; v++) {
+        for (uint16_t s = 0; s < 256; s++) {
+            for (uint16_t h = 0; h < 256; h++) {
+                hsv[h] = (HSV){(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            hsv_to_rgb_batch(hsv, rgb, 255);
+            hsv_to_rgb_batch(&hsv[255], &rgb[255], 1);
+            hsv_to_rgb_batch_nocie(hsv, rgb_nocie, 255);
+            hsv_to_rgb_batch_nocie(&hsv[255], &rgb_nocie[255], 1);
+            for (uint16_t h = 0; h < 256; h++) {
+                RGB expected       = reference_hsv_to_rgb(hsv[h], true);
+                RGB expected_nocie = reference_hsv_to_rgb(hsv[h], false);
+                ASSERT_TRUE(rgb_matches("hsv_to_rgb", hsv[h], hsv_to_rgb(hsv[h]), expected));
+                ASSERT_TRUE(rgb_matches("hsv_to_rgb_batch", hsv[h], rgb[h], expected));
+                ASSERT_TRUE(rgb_matches("hsv_to_rgb_nocie", hsv[h], hsv_to_rgb_nocie(hsv[h]), expected_nocie));
+                ASSERT_TRUE(rgb_matches("hsv_to_rgb_batch_nocie", hsv[h], rgb_nocie[h], expected_nocie));
+            }
+        }
+    }
+}
+
+TEST_F(RgbMatrixRender, SuspendShutsDownDriver) {
+    rgb_matrix_virtual_stats_t stats;
+
+    rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    ASSERT_TRUE(render_frame());
+
+    rgb_matrix_set_suspend_state(true);
+    for (int i = 0; i < MAX_TASK_CALLS; ++i) {
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        rgb_matrix_task();
+    }
+    rgb_matrix_virtual_get_stats(&stats);
+    EXPECT_EQ(stats.shutdowns, 1);
+    EXPECT_EQ(stats.wakeups, 0);
+    RGB off = rgb_matrix_virtual_get_color(0);
+    EXPECT_EQ(off.r + off.g + off.b, 0);
+
+    // Nothing reaches the driver while it is shut down
+    uint32_t flushes = stats.flushes;
+    EXPECT_FALSE(render_frame());
+    rgb_matrix_virtual_get_stats(&stats);
+    EXPECT_EQ(stats.flushes, flushes);
+
+    rgb_matrix_set_suspend_state(false);
+    ASSERT_TRUE(render_frame());
+    rgb_matrix_virtual_get_stats(&stats);
+    EXPECT_EQ(stats.shutdowns, 1);
+    EXPECT_EQ(stats.wakeups, 1);
+    RGB on = rgb_matrix_virtual_get_color(0);
+    EXPECT_EQ(on.r, 255);
+}
+
+TEST_F(RgbMatrixRender, EffectResumesAfterSuspend) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+    ASSERT_TRUE(render_frame());
+    rgb_matrix_handle_key_event(2, 3, true);
+    ASSERT_TRUE(render_frame());
+    uint8_t heat = g_rgb_frame_buffer[2][3];
+    ASSERT_GT(heat, 0);
+
+    rgb_matrix_set_suspend_state(true);
+    for (int i = 0; i < MAX_TASK_CALLS; ++i) {
+        rgb_matrix_task();
+    }
+    rgb_matrix_set_suspend_state(false);
+
+    // The heatmap is not reinitialised on wake, which would have cleared it
+    ASSERT_TRUE(render_frame());
+    EXPECT_GT(g_rgb_frame_buffer[2][3], 0);
+    RGB rgb = rgb_matrix_virtual_get_color(g_led_config.matrix_co[2][3]);
+    EXPECT_GT(rgb.r + rgb.g + rgb.b, 0);
+}
+
+TEST_F(RgbMatrixRender, RendersEveryEffect) {
+    const char *frames_env = getenv("RGB_MATRIX_RENDER_FRAMES");
+    const char *dump_dir   = getenv("RGB_MATRIX_RENDER_DUMP_DIR");
+    uint32_t    frames     = frames_env ? strtoul(frames_env, NULL, 10) : DEFAULT_FRAMES;
+
+    std::vector<frame_cost_t> costs(sizeof(effects) / sizeof(effects[0]));
+
+    for (size_t e = 0; e < costs.size(); ++e) {
+        const effect_t *effect = &effects[e];
+        frame_cost_t   *cost   = &costs[e];
+        *cost                  = {};
+
+        rgb_matrix_mode_noeeprom(effect->mode);
+        ASSERT_EQ(rgb_matrix_get_mode(), effect->mode) << effect->name;
+
+        for (uint32_t frame = 0; frame < frames; ++frame) {
+            if (frame % KEYPRESS_INTERVAL == 0) {
+                // Walk the matrix in a fixed pattern so every run sees the same presses
+                uint32_t press = frame / KEYPRESS_INTERVAL;
+                rgb_matrix_handle_key_event((press * 3) % MATRIX_ROWS, (press * 7) % MATRIX_COLS, true);
+            }
+            ASSERT_TRUE(render_frame(cost)) << effect->name << " did not finish frame " << frame;
+
+            if (dump_dir) {
+                char path[256];
+                snprintf(path, sizeof(path), "%s/%03u_%s_%05u.ppm", dump_dir, effect->mode, effect->name, (unsigned)frame);
+                ASSERT_TRUE(rgb_matrix_virtual_write_ppm(path, DUMP_SCALE)) << path;
+            }
+        }
+    }
+
+    printf("%-32s %12s %12s %14s %12s\n", "effect", "ns/frame", "max ns", "cycles/frame", "writes/frame");
+    for (size_t e = 0; e < costs.size(); ++e) {
+        const frame_cost_t *cost = &costs[e];
+        if (cost->frames == 0) {
+            continue;
+        }
+        printf("%-32s %12llu %12llu %14llu %12lu\n", effects[e].name, (unsigned long long)(cost->total_ns / cost->frames), (unsigned long long)cost->max_ns, (unsigned long long)(cost->total_cycles / cost->frames), (unsigned long)(cost->set_color_calls / cost->frames));
+    }
+}
@@ -0,0 +1,62 @@
+rgb_matrix_render_DEFS := -DRGB_MATRIX_ENABLE -DEEPROM_TEST_HARNESS
+rgb_matrix_render_CONFIG := $(QUANTUM_PATH)/rgb_matrix/tests/config_rgb_matrix_render.h
+rgb_matrix_render_INC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+
+rgb_matrix_render_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/rgb_matrix_virtual.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/logging/debug.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/mock_rgb_matrix_render.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_render_tests.cpp
+
+rgb_matrix_layers_DEFS := -DRGB_MATRIX_ENABLE -DRGB_MATRIX_LAYERS -DEEPROM_TEST_HARNESS
+rgb_matrix_layers_CONFIG := $(rgb_matrix_render_CONFIG)
+rgb_matrix_layers_INC := $(rgb_matrix_render_INC)
+
+rgb_matrix_layers_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/rgb_matrix_virtual.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/logging/debug.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix_layers.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/mock_rgb_matrix_render.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_layers_tests.cpp
+
+rgb_matrix_correction_DEFS := -DRGB_MATRIX_ENABLE -DRGB_MATRIX_CORRECTION -DEEPROM_TEST_HARNESS
+rgb_matrix_correction_CONFIG := $(rgb_matrix_render_CONFIG)
+rgb_matrix_correction_INC := $(rgb_matrix_render_INC)
+
+rgb_matrix_correction_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/rgb_matrix_virtual.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/logging/debug.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix_correction.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/mock_rgb_matrix_render.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_correction_tests.cpp
+
+rgb_matrix_budget_DEFS := -DRGB_MATRIX_ENABLE -DEEPROM_TEST_HARNESS
+rgb_matrix_budget_CONFIG := $(QUANTUM_PATH)/rgb_matrix/tests/config_rgb_matrix_budget.h
+rgb_matrix_budget_INC := $(rgb_matrix_render_INC)
+
+rgb_matrix_budget_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/rgb_matrix_virtual.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/logging/debug.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/mock_rgb_matrix_render.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_budget_tests.cpp
@@ -0,0 +1 @@
+TEST_LIST += rgb_matrix_render rgb_matrix_layers rgb_matrix_correction rgb_matrix_budget
@@ -145,6 +145,13 @@ __attribute__((weak)) RGB rgblight_hsv_to_rgb(HSV hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Goes through rgblight_hsv_to_rgb() so that keyboards overriding it also change the batched effects
+__attribute__((weak)) void rgblight_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgblight_hsv_to_rgb(hsv[i]);
+    }
+}
+
 void setrgb(uint8_t r, uint8_t g, uint8_t b, rgb_led_t *led1) {
     led1->r = r;
     led1->g = g;
@@ -164,6 +171,35 @@ void sethsv(uint8_t hue, uint8_t sat, uint8_t val, rgb_led_t *led1) {
     sethsv_raw(hue, sat, val > RGBLIGHT_LIMIT_VAL ? RGBLIGHT_LIMIT_VAL : val, led1);
 }
 
+#if defined(RGBLIGHT_EFFECT_STATIC_GRADIENT) || defined(RGBLIGHT_EFFECT_RAINBOW_SWIRL) || defined(RGBLIGHT_EFFECT_TWINKLE)
+// Colours for a run of consecutive LEDs, converted together when the run ends or the batch fills up
+typedef struct {
+    HSV     hsv[RGBLIGHT_HSV_BATCH_SIZE];
+    uint8_t start;
+    uint8_t count;
+} rgblight_hsv_batch_t;
+
+static void rgblight_hsv_batch_flush(rgblight_hsv_batch_t *batch) {
+    RGB rgb[RGBLIGHT_HSV_BATCH_SIZE];
+    rgblight_hsv_to_rgb_batch(batch->hsv, rgb, batch->count);
+    for (uint8_t i = 0; i < batch->count; i++) {
+        setrgb(rgb[i].r, rgb[i].g, rgb[i].b, &led[batch->start + i]);
+    }
+    batch->count = 0;
+}
+
+// Same as sethsv(hue, sat, val, &led[index]), once the batch is flushed
+static void rgblight_hsv_batch_add(rgblight_hsv_batch_t *batch, uint8_t index, uint8_t hue, uint8_t sat, uint8_t val) {
+    if (batch->count > 0 && (batch->count == RGBLIGHT_HSV_BATCH_SIZE || index != batch->start + batch->count)) {
+        rgblight_hsv_batch_flush(batch);
+    }
+    if (batch->count == 0) {
+        batch->start = index;
+    }
+    batch->hsv[batch->count++] = (HSV){hue, sat, val > RGBLIGHT_LIMIT_VAL ? RGBLIGHT_LIMIT_VAL : val};
+}
+#endif
+
 void rgblight_check_config(void) {
     /* Add some out of bound checks for RGB light config */
 
@@ -566,7 +602,8 @@ void rgblight_sethsv_eeprom_helper(uint8_t hue, uint8_t sat, uint8_t val, bool w
                 uint8_t delta     = rgblight_config.mode - rgblight_status.base_mode;
                 bool    direction = (delta % 2) == 0;
 
-                uint8_t range = pgm_read_byte(&RGBLED_GRADIENT_RANGES[delta / 2]);
+                uint8_t              range = pgm_read_byte(&RGBLED_GRADIENT_RANGES[delta / 2]);
+                rgblight_hsv_batch_t batch = {.count = 0};
                 for (uint8_t i = 0; i < rgblight_ranges.effect_num_leds; i++) {
                     uint8_t _hue = ((uint16_t)i * (uint16_t)range) / rgblight_ranges.effect_num_leds;
                     if (direction) {
@@ -575,8 +612,9 @@ void rgblight_sethsv_eeprom_helper(uint8_t hue, uint8_t sat, uint8_t val, bool w
                         _hue = hue - _hue;
                     }
                     dprintf("rgblight rainbow set hsv: %d,%d,%d,%u\n", i, _hue, direction, range);
-                    sethsv(_hue, sat, val, (rgb_led_t *)&led[i + rgblight_ranges.effect_start_pos]);
+                    rgblight_hsv_batch_add(&batch, i + rgblight_ranges.effect_start_pos, _hue, sat, val);
                 }
+                rgblight_hsv_batch_flush(&batch);
 #    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
                 // needed for rgblight_layers_write() to get the new val, since it reads rgblight_config.val
                 rgblight_config.val = val;
@@ -683,18 +721,6 @@ void rgblight_sethsv_at(uint8_t hue, uint8_t sat, uint8_t val, uint8_t index) {
     rgblight_setrgb_at(tmp_led.r, tmp_led.g, tmp_led.b, index);
 }
 
-#if defined(RGBLIGHT_EFFECT_BREATHING) || defined(RGBLIGHT_EFFECT_RAINBOW_MOOD) || defined(RGBLIGHT_EFFECT_RAINBOW_SWIRL) || defined(RGBLIGHT_EFFECT_SNAKE) || defined(RGBLIGHT_EFFECT_KNIGHT) || defined(RGBLIGHT_EFFECT_TWINKLE)
-
-static uint8_t get_interval_time(const uint8_t *default_interval_address, uint8_t velocikey_min, uint8_t velocikey_max) {
-    return
-#    ifdef VELOCIKEY_ENABLE
-        rgblight_velocikey_enabled() ? rgblight_velocikey_match_speed(velocikey_min, velocikey_max) :
-#    endif
-                                     pgm_read_byte(default_interval_address);
-}
-
-#endif
-
 void rgblight_setrgb_range(uint8_t r, uint8_t g, uint8_t b, uint8_t start, uint8_t end) {
     if (!rgblight_config.enable || start < 0 || start >= end || end > RGBLIGHT_LED_COUNT) {
         return;
@@ -1041,77 +1067,92 @@ static void rgblight_effect_dummy(animation_status_t *anim) {
     **/
 }
 
-void rgblight_timer_task(void) {
-    if (rgblight_status.timer_enabled) {
-        effect_func_t effect_func   = rgblight_effect_dummy;
-        uint16_t      interval_time = 2000; // dummy interval
-        uint8_t       delta         = rgblight_config.mode - rgblight_status.base_mode;
-        animation_status.delta      = delta;
+// The effect for the current mode, chosen when the mode changes rather than on every tick
+static effect_func_t rgblight_effect_func     = rgblight_effect_dummy;
+static uint16_t      rgblight_effect_interval = 2000; // dummy interval
+static uint8_t       rgblight_effect_mode     = 0;    // mode the two above were chosen for
+#    ifdef VELOCIKEY_ENABLE
+static uint8_t rgblight_effect_velocikey_min = 0;
+static uint8_t rgblight_effect_velocikey_max = 0; // 0 if the effect's speed is not controlled by Velocikey
+#    endif
 
-        // static light mode, do nothing here
-        if (1 == 0) { // dummy
-        }
+static void rgblight_effect_set(effect_func_t func, uint16_t interval, uint8_t velocikey_min, uint8_t velocikey_max) {
+    rgblight_effect_func     = func;
+    rgblight_effect_interval = interval;
+#    ifdef VELOCIKEY_ENABLE
+    rgblight_effect_velocikey_min = velocikey_min;
+    rgblight_effect_velocikey_max = velocikey_max;
+#    endif
+}
+
+static void rgblight_effect_select(void) {
+    uint8_t delta          = rgblight_config.mode - rgblight_status.base_mode;
+    animation_status.delta = delta;
+    rgblight_effect_mode   = rgblight_config.mode;
+    rgblight_effect_set(rgblight_effect_dummy, 2000, 0, 0);
+
+    // static light mode, do nothing here
+    if (1 == 0) { // dummy
+    }
 #    ifdef RGBLIGHT_EFFECT_BREATHING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_BREATHING) {
-            // breathing mode
-            interval_time = get_interval_time(&RGBLED_BREATHING_INTERVALS[delta], 1, 100);
-            effect_func   = rgblight_effect_breathing;
-        }
+    else if (rgblight_status.base_mode == RGBLIGHT_MODE_BREATHING) {
+        // breathing mode
+        rgblight_effect_set(rgblight_effect_breathing, pgm_read_byte(&RGBLED_BREATHING_INTERVALS[delta]), 1, 100);
+    }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_MOOD
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_MOOD) {
-            // rainbow mood mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_MOOD_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_rainbow_mood;
-        }
+    else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_MOOD) {
+        // rainbow mood mode
+        rgblight_effect_set(rgblight_effect_rainbow_mood, pgm_read_byte(&RGBLED_RAINBOW_MOOD_INTERVALS[delta]), 5, 100);
+    }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_SWIRL
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_SWIRL) {
-            // rainbow swirl mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_SWIRL_INTERVALS[delta / 2], 1, 100);
-            effect_func   = rgblight_effect_rainbow_swirl;
-        }
+    else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_SWIRL) {
+        // rainbow swirl mode
+        rgblight_effect_set(rgblight_effect_rainbow_swirl, pgm_read_byte(&RGBLED_RAINBOW_SWIRL_INTERVALS[delta / 2]), 1, 100);
+    }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_SNAKE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_SNAKE) {
-            // snake mode
-            interval_time = get_interval_time(&RGBLED_SNAKE_INTERVALS[delta / 2], 1, 200);
-            effect_func   = rgblight_effect_snake;
-        }
+    else if (rgblight_status.base_mode == RGBLIGHT_MODE_SNAKE) {
+        // snake mode
+        rgblight_effect_set(rgblight_effect_snake, pgm_read_byte(&RGBLED_SNAKE_INTERVALS[delta / 2]), 1, 200);
+    }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_KNIGHT
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_KNIGHT) {
-            // knight mode
-            interval_time = get_interval_time(&RGBLED_KNIGHT_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_knight;
-        }
+    else if (rgblight_status.base_mode == RGBLIGHT_MODE_KNIGHT) {
+        // knight mode
+        rgblight_effect_set(rgblight_effect_knight, pgm_read_byte(&RGBLED_KNIGHT_INTERVALS[delta]), 5, 100);
+    }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_CHRISTMAS
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_CHRISTMAS) {
-            // christmas mode
-            interval_time = RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL;
-            effect_func   = (effect_func_t)rgblight_effect_christmas;
-        }
+    else if (rgblight_status.base_mode == RGBLIGHT_MODE_CHRISTMAS) {
+        // christmas mode
+        rgblight_effect_set((effect_func_t)rgblight_effect_christmas, RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL, 0, 0);
+    }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RGB_TEST
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RGB_TEST) {
-            // RGB test mode
-            interval_time = pgm_read_word(&RGBLED_RGBTEST_INTERVALS[0]);
-            effect_func   = (effect_func_t)rgblight_effect_rgbtest;
-        }
+    else if (rgblight_status.base_mode == RGBLIGHT_MODE_RGB_TEST) {
+        // RGB test mode
+        rgblight_effect_set((effect_func_t)rgblight_effect_rgbtest, pgm_read_word(&RGBLED_RGBTEST_INTERVALS[0]), 0, 0);
+    }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_ALTERNATING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_ALTERNATING) {
-            interval_time = 500;
-            effect_func   = (effect_func_t)rgblight_effect_alternating;
-        }
+    else if (rgblight_status.base_mode == RGBLIGHT_MODE_ALTERNATING) {
+        rgblight_effect_set((effect_func_t)rgblight_effect_alternating, 500, 0, 0);
+    }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_TWINKLE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_TWINKLE) {
-            interval_time = get_interval_time(&RGBLED_TWINKLE_INTERVALS[delta % 3], 5, 30);
-            effect_func   = (effect_func_t)rgblight_effect_twinkle;
-        }
+    else if (rgblight_status.base_mode == RGBLIGHT_MODE_TWINKLE) {
+        rgblight_effect_set((effect_func_t)rgblight_effect_twinkle, pgm_read_byte(&RGBLED_TWINKLE_INTERVALS[delta % 3]), 5, 30);
+    }
 #    endif
+}
+
+void rgblight_timer_task(void) {
+    if (rgblight_status.timer_enabled) {
+        if (rgblight_config.mode != rgblight_effect_mode) {
+            rgblight_effect_select();
+        }
         if (animation_status.restart) {
             animation_status.restart    = false;
             animation_status.last_timer = sync_timer_read();
@@ -1132,9 +1173,15 @@ void rgblight_timer_task(void) {
                 }
             }
             oldpos16 = animation_status.pos16;
+#    endif
+            uint16_t interval_time = rgblight_effect_interval;
+#    ifdef VELOCIKEY_ENABLE
+            if (rgblight_effect_velocikey_max && rgblight_velocikey_enabled()) {
+                interval_time = rgblight_velocikey_match_speed(rgblight_effect_velocikey_min, rgblight_effect_velocikey_max);
+            }
 #    endif
             animation_status.last_timer += interval_time;
-            effect_func(&animation_status);
+            rgblight_effect_func(&animation_status);
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
             if (animation_status.pos16 == 0 && oldpos16 != 0) {
                 tick_flag = true;
@@ -1217,13 +1264,15 @@ void rgblight_effect_rainbow_mood(animation_status_t *anim) {
 __attribute__((weak)) const uint8_t RGBLED_RAINBOW_SWIRL_INTERVALS[] PROGMEM = {100, 50, 20};
 
 void rgblight_effect_rainbow_swirl(animation_status_t *anim) {
-    uint8_t hue;
-    uint8_t i;
+    rgblight_hsv_batch_t batch = {.count = 0};
+    uint8_t              hue;
+    uint8_t              i;
 
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
         hue = (RGBLIGHT_RAINBOW_SWIRL_RANGE / rgblight_ranges.effect_num_leds * i + anim->current_hue);
-        sethsv(hue, rgblight_config.sat, rgblight_config.val, (rgb_led_t *)&led[i + rgblight_ranges.effect_start_pos]);
+        rgblight_hsv_batch_add(&batch, i + rgblight_ranges.effect_start_pos, hue, rgblight_config.sat, rgblight_config.val);
     }
+    rgblight_hsv_batch_flush(&batch);
     rgblight_set();
 
     if (anim->delta % 2) {
@@ -1266,17 +1315,18 @@ void rgblight_effect_snake(animation_status_t *anim) {
 #    ifdef WS2812_RGBW
         ledp->w = 0;
 #    endif
-        for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
-            k = pos + j * increment;
-            if (k > RGBLIGHT_LED_COUNT) {
-                k = k % (RGBLIGHT_LED_COUNT);
-            }
-            if (k < 0) {
-                k = k + rgblight_ranges.effect_num_leds;
-            }
-            if (i == k) {
-                sethsv(rgblight_config.hue, rgblight_config.sat, (uint8_t)(rgblight_config.val * (RGBLIGHT_EFFECT_SNAKE_LENGTH - j) / RGBLIGHT_EFFECT_SNAKE_LENGTH), ledp);
-            }
+    }
+    // Light each segment of the snake in turn, rather than searching the snake for every LED
+    for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
+        k = pos + j * increment;
+        if (k > RGBLIGHT_LED_COUNT) {
+            k = k % (RGBLIGHT_LED_COUNT);
+        }
+        if (k < 0) {
+            k = k + rgblight_ranges.effect_num_leds;
+        }
+        if (k < rgblight_ranges.effect_num_leds) {
+            sethsv(rgblight_config.hue, rgblight_config.sat, (uint8_t)(rgblight_config.val * (RGBLIGHT_EFFECT_SNAKE_LENGTH - j) / RGBLIGHT_EFFECT_SNAKE_LENGTH), led + k + rgblight_ranges.effect_start_pos);
         }
     }
     rgblight_set();
@@ -1309,6 +1359,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
     static int8_t high_bound = RGBLIGHT_EFFECT_KNIGHT_LENGTH - 1;
     static int8_t increment  = RGBLIGHT_EFFECT_KNIGHT_INCREMENT;
     uint8_t       i, cur;
+    rgb_led_t     lit;
 
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
     if (anim->pos == 0) { // restart signal
@@ -1328,11 +1379,12 @@ void rgblight_effect_knight(animation_status_t *anim) {
 #    endif
     }
     // Determine which LEDs should be lit up
+    sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, &lit);
     for (i = 0; i < RGBLIGHT_EFFECT_KNIGHT_LED_NUM; i++) {
         cur = (i + RGBLIGHT_EFFECT_KNIGHT_OFFSET) % rgblight_ranges.effect_num_leds + rgblight_ranges.effect_start_pos;
 
         if (i >= low_bound && i <= high_bound) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, (rgb_led_t *)&led[cur]);
+            led[cur] = lit;
         } else {
             led[cur].r = 0;
             led[cur].g = 0;
@@ -1371,9 +1423,10 @@ void rgblight_effect_christmas(animation_status_t *anim) {
     const uint8_t max_pos   = 32;
     const uint8_t hue_green = 85;
 
-    uint32_t xa;
-    uint8_t  hue, val;
-    uint8_t  i;
+    uint32_t  xa;
+    uint8_t   hue, val;
+    uint8_t   i;
+    rgb_led_t colors[2];
 
     // The effect works by animating anim->pos from 0 to 32 and back to 0.
     // The pos is used in a cubic bezier formula to ease-in-out between red and green, leaving the interpolated colors visible as short as possible.
@@ -1382,9 +1435,11 @@ void rgblight_effect_christmas(animation_status_t *anim) {
     // Additionally, these interpolated colors get shown with a slightly darker value, to make them less prominent than the main colors.
     val = 255 - (3 * (hue < hue_green / 2 ? hue : hue_green - hue) / 2);
 
+    // Every LED shows one of the two colours, so only those need converting
+    sethsv(hue_green - hue, rgblight_config.sat, val, &colors[0]);
+    sethsv(hue, rgblight_config.sat, val, &colors[1]);
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        uint8_t local_hue = (i / RGBLIGHT_EFFECT_CHRISTMAS_STEP) % 2 ? hue : hue_green - hue;
-        sethsv(local_hue, rgblight_config.sat, val, (rgb_led_t *)&led[i + rgblight_ranges.effect_start_pos]);
+        led[i + rgblight_ranges.effect_start_pos] = colors[(i / RGBLIGHT_EFFECT_CHRISTMAS_STEP) % 2];
     }
     rgblight_set();
 
@@ -1430,14 +1485,18 @@ void rgblight_effect_rgbtest(animation_status_t *anim) {
 
 #ifdef RGBLIGHT_EFFECT_ALTERNATING
 void rgblight_effect_alternating(animation_status_t *anim) {
+    rgb_led_t on, off;
+    sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, &on);
+    sethsv(rgblight_config.hue, rgblight_config.sat, 0, &off);
+
     for (int i = 0; i < rgblight_ranges.effect_num_leds; i++) {
         rgb_led_t *ledp = led + i + rgblight_ranges.effect_start_pos;
         if (i < rgblight_ranges.effect_num_leds / 2 && anim->pos) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, ledp);
+            *ledp = on;
         } else if (i >= rgblight_ranges.effect_num_leds / 2 && !anim->pos) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, ledp);
+            *ledp = on;
         } else {
-            sethsv(rgblight_config.hue, rgblight_config.sat, 0, ledp);
+            *ledp = off;
         }
     }
     rgblight_set();
@@ -1471,7 +1530,8 @@ void rgblight_effect_twinkle(animation_status_t *anim) {
         return (v * scale) >> 8;
     }
 
-    const uint8_t trigger = scale((uint16_t)0xFF * RGBLIGHT_EFFECT_TWINKLE_PROBABILITY, 127 + rgblight_config.val / 2);
+    const uint8_t        trigger = scale((uint16_t)0xFF * RGBLIGHT_EFFECT_TWINKLE_PROBABILITY, 127 + rgblight_config.val / 2);
+    rgblight_hsv_batch_t batch   = {.count = 0};
 
     for (uint8_t i = 0; i < rgblight_ranges.effect_num_leds; i++) {
         TwinkleState *t = &(led_twinkle_state[i]);
@@ -1504,9 +1564,9 @@ void rgblight_effect_twinkle(animation_status_t *anim) {
             // This LED is off, and was NOT selected to start brightening
         }
 
-        rgb_led_t *ledp = led + i + rgblight_ranges.effect_start_pos;
-        sethsv(c->h, c->s, c->v, ledp);
+        rgblight_hsv_batch_add(&batch, i + rgblight_ranges.effect_start_pos, c->h, c->s, c->v);
     }
+    rgblight_hsv_batch_flush(&batch);
 
     rgblight_set();
 }
@@ -163,6 +163,9 @@ enum RGBLIGHT_EFFECT_MODE {
 #ifndef RGBLIGHT_LIMIT_VAL
 #    define RGBLIGHT_LIMIT_VAL 255
 #endif
+#ifndef RGBLIGHT_HSV_BATCH_SIZE
+#    define RGBLIGHT_HSV_BATCH_SIZE 16
+#endif
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -292,6 +295,10 @@ extern rgblight_ranges_t rgblight_ranges;
 void rgblight_set(void);
 void rgblight_set_clipping_range(uint8_t start_pos, uint8_t num_leds);
 
+/*   colour conversion used by the effects, weak so that keyboards can replace it */
+RGB  rgblight_hsv_to_rgb(HSV hsv);
+void rgblight_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count);
+
 /* === Effects and Animations Functions === */
 /*   effect range setting */
 void rgblight_set_effect_range(uint8_t start_pos, uint8_t num_leds);
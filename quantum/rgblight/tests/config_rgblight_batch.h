@@ -0,0 +1,13 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define RGBLIGHT_LED_COUNT 30
+
+#define RGBLIGHT_EFFECT_RAINBOW_SWIRL
+#define RGBLIGHT_EFFECT_STATIC_GRADIENT
+#define RGBLIGHT_EFFECT_TWINKLE
+#define RGBLIGHT_EFFECT_BREATHE_CENTER 1.85
+
+// Smaller than the strip so that the effects fill several batches
+#define RGBLIGHT_HSV_BATCH_SIZE 8
@@ -0,0 +1,28 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "rgblight.h"
+
+// The last frame sent to the LEDs
+rgb_led_t rgblight_mock_frame[RGBLIGHT_LED_COUNT];
+
+static void rgblight_mock_init(void) {}
+
+static void rgblight_mock_setleds(rgb_led_t *ledarray, uint16_t number_of_leds) {
+    memcpy(rgblight_mock_frame, ledarray, number_of_leds * sizeof(rgb_led_t));
+}
+
+const rgblight_driver_t rgblight_driver = {
+    .init    = rgblight_mock_init,
+    .setleds = rgblight_mock_setleds,
+};
+
+#ifdef RGBLIGHT_MOCK_HSV_TO_RGB
+// Halves the brightness, like the keyboards that limit their current draw
+RGB rgblight_hsv_to_rgb(HSV hsv) {
+    hsv.v /= 2;
+    return hsv_to_rgb(hsv);
+}
+#endif
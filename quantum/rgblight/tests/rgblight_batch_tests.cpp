@@ -0,0 +1,190 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define _Static_assert static_assert
+
+extern "C" {
+#include "progmem.h"
+#include "rgblight.h"
+#include "timer.h"
+}
+
+extern "C" {
+extern rgblight_config_t rgblight_config;
+extern const uint8_t     RGBLED_GRADIENT_RANGES[];
+extern rgb_led_t         rgblight_mock_frame[RGBLIGHT_LED_COUNT];
+
+void sethsv(uint8_t hue, uint8_t sat, uint8_t val, rgb_led_t *led1);
+}
+
+/*
+ * The effects that fill runs of LEDs convert their colours in batches. These
+ * tests render them next to the per-LED code they replaced, which called
+ * sethsv() for every LED, and expect the same frames. With
+ * RGBLIGHT_MOCK_HSV_TO_RGB the mock overrides rgblight_hsv_to_rgb(), and the
+ * batches have to go through it as sethsv() does, without any other config.
+ */
+
+#define FRAMES 400
+#define TWINKLE_SEED 7
+
+typedef struct {
+    HSV     hsv;
+    uint8_t life;
+    uint8_t max_life;
+} twinkle_state_t;
+
+static uint8_t reference_breathe_calc(uint8_t pos) {
+    return (exp(sin((pos / 255.0) * M_PI)) - RGBLIGHT_EFFECT_BREATHE_CENTER / M_E) * (RGBLIGHT_EFFECT_BREATHE_MAX / (M_E - 1 / M_E));
+}
+
+static uint8_t reference_frac(uint8_t n, uint8_t d) {
+    return (uint16_t)255 * n / d;
+}
+
+static uint8_t reference_scale(uint16_t v, uint8_t scale) {
+    return (v * scale) >> 8;
+}
+
+class RgblightBatch : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_clear();
+        is_rgblight_initialized = false;
+        rgblight_init();
+        rgblight_enable_noeeprom();
+        memset(rgblight_mock_frame, 0, sizeof(rgblight_mock_frame));
+    }
+
+    void expect_frame(const rgb_led_t *expected, int frame) {
+        for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; ++i) {
+            EXPECT_EQ(rgblight_mock_frame[i].r, expected[i].r) << "frame " << frame << " LED " << (int)i;
+            EXPECT_EQ(rgblight_mock_frame[i].g, expected[i].g) << "frame " << frame << " LED " << (int)i;
+            EXPECT_EQ(rgblight_mock_frame[i].b, expected[i].b) << "frame " << frame << " LED " << (int)i;
+        }
+    }
+
+    // The twinkle effect before batching, with its own state
+    void reference_twinkle(twinkle_state_t *state, uint8_t delta, bool restart, rgb_led_t *out) {
+        const bool    random_color = delta / 3;
+        const uint8_t bottom       = reference_breathe_calc(0);
+        const uint8_t top          = reference_breathe_calc(127);
+        const uint8_t trigger      = reference_scale((uint16_t)0xFF * RGBLIGHT_EFFECT_TWINKLE_PROBABILITY, 127 + rgblight_config.val / 2);
+
+        for (uint8_t i = 0; i < rgblight_ranges.effect_num_leds; i++) {
+            twinkle_state_t *t = &state[i];
+            HSV             *c = &t->hsv;
+
+            if (!random_color) {
+                c->h = rgblight_config.hue;
+                c->s = rgblight_config.sat;
+            }
+
+            if (restart) {
+                t->life = 0;
+                c->v    = 0;
+            } else if (t->life) {
+                t->life--;
+                uint8_t unscaled = reference_frac(reference_breathe_calc(reference_frac(t->life, t->max_life)) - bottom, top - bottom);
+                c->v             = reference_scale(rgblight_config.val, unscaled);
+            } else if ((rand() % 0xFF) < trigger) {
+                if (random_color) {
+                    c->h = rand() % 0xFF;
+                    c->s = (rand() % (rgblight_config.sat / 2)) + (rgblight_config.sat / 2);
+                }
+                c->v        = 0;
+                t->max_life = MAX(20, MIN(RGBLIGHT_EFFECT_TWINKLE_LIFE, rgblight_config.val));
+                t->life     = t->max_life;
+            }
+
+            sethsv(c->h, c->s, c->v, &out[i + rgblight_ranges.effect_start_pos]);
+        }
+    }
+};
+
+TEST_F(RgblightBatch, StaticGradientMatchesPerLed) {
+    for (uint8_t delta = 0; delta < 10; ++delta) {
+        for (uint16_t hue = 0; hue < 256; hue += 37) {
+            rgblight_sethsv_noeeprom(hue, 200, 180);
+            rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_GRADIENT + delta);
+
+            bool      direction = (delta % 2) == 0;
+            uint8_t   range     = pgm_read_byte(&RGBLED_GRADIENT_RANGES[delta / 2]);
+            rgb_led_t expected[RGBLIGHT_LED_COUNT];
+            for (uint8_t i = 0; i < rgblight_ranges.effect_num_leds; i++) {
+                uint8_t _hue = ((uint16_t)i * (uint16_t)range) / rgblight_ranges.effect_num_leds;
+                _hue         = direction ? hue + _hue : hue - _hue;
+                sethsv(_hue, 200, 180, &expected[i + rgblight_ranges.effect_start_pos]);
+            }
+            expect_frame(expected, delta * 256 + hue);
+        }
+    }
+}
+
+TEST_F(RgblightBatch, RainbowSwirlMatchesPerLed) {
+    rgblight_sethsv_noeeprom(0, 255, 200);
+
+    for (uint8_t delta = 0; delta < 6; ++delta) {
+        animation_status_t anim = {};
+        anim.delta              = delta;
+
+        for (int frame = 0; frame < FRAMES; ++frame) {
+            rgb_led_t expected[RGBLIGHT_LED_COUNT];
+            for (uint8_t i = 0; i < rgblight_ranges.effect_num_leds; i++) {
+                uint8_t hue = (255 / rgblight_ranges.effect_num_leds * i + anim.current_hue);
+                sethsv(hue, rgblight_config.sat, rgblight_config.val, &expected[i + rgblight_ranges.effect_start_pos]);
+            }
+
+            rgblight_effect_rainbow_swirl(&anim);
+            expect_frame(expected, frame);
+        }
+    }
+}
+
+TEST_F(RgblightBatch, TwinkleMatchesPerLed) {
+    rgblight_sethsv_noeeprom(170, 220, 255);
+
+    for (uint8_t delta = 0; delta < 6; delta += 3) {
+        static rgb_led_t frames[FRAMES][RGBLIGHT_LED_COUNT];
+        animation_status_t anim = {};
+        anim.delta              = delta;
+
+        srand(TWINKLE_SEED);
+        for (int frame = 0; frame < FRAMES; ++frame) {
+            rgblight_effect_twinkle(&anim);
+            memcpy(frames[frame], rgblight_mock_frame, sizeof(rgblight_mock_frame));
+        }
+
+        twinkle_state_t state[RGBLIGHT_LED_COUNT] = {};
+        srand(TWINKLE_SEED);
+        bool lit = false;
+        for (int frame = 0; frame < FRAMES; ++frame) {
+            rgb_led_t expected[RGBLIGHT_LED_COUNT];
+            reference_twinkle(state, delta, frame == 0, expected);
+            memcpy(rgblight_mock_frame, frames[frame], sizeof(rgblight_mock_frame));
+            expect_frame(expected, frame);
+            for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; ++i) {
+                lit |= expected[i].r || expected[i].g || expected[i].b;
+            }
+        }
+        // Otherwise the comparison above proves little
+        EXPECT_TRUE(lit);
+    }
+}
+
+#ifdef RGBLIGHT_MOCK_HSV_TO_RGB
+TEST_F(RgblightBatch, BatchesGoThroughOverride) {
+    rgblight_sethsv_noeeprom(0, 0, 255);
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_GRADIENT);
+
+    RGB full = hsv_to_rgb((HSV){0, 0, 255});
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; ++i) {
+        EXPECT_LT(rgblight_mock_frame[i].r, full.r) << "LED " << (int)i;
+    }
+}
+#endif
@@ -0,0 +1,21 @@
+rgblight_batch_DEFS := -DRGBLIGHT_ENABLE -DEEPROM_ENABLE -DEEPROM_TEST_HARNESS
+rgblight_batch_CONFIG := $(QUANTUM_PATH)/rgblight/tests/config_rgblight_batch.h
+rgblight_batch_INC := \
+	$(QUANTUM_PATH)/rgblight/tests \
+	$(QUANTUM_PATH)/rgblight
+
+rgblight_batch_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/logging/debug.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/rgblight/rgblight.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/rgblight/tests/mock_rgblight_batch.c \
+	$(QUANTUM_PATH)/rgblight/tests/rgblight_batch_tests.cpp
+
+rgblight_batch_custom_DEFS := $(rgblight_batch_DEFS) -DRGBLIGHT_MOCK_HSV_TO_RGB
+rgblight_batch_custom_CONFIG := $(rgblight_batch_CONFIG)
+rgblight_batch_custom_INC := $(rgblight_batch_INC)
+rgblight_batch_custom_SRC := $(rgblight_batch_SRC)
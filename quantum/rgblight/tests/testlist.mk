@@ -0,0 +1 @@
+TEST_LIST += rgblight_batch rgblight_batch_custom
@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Delta sync only carries the split lighting state, so it is dropped when none of it is being synced
+#if defined(SPLIT_DELTA_SYNC_ENABLE) && !((defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)) || (defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)) || (defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)))
+#    undef SPLIT_DELTA_SYNC_ENABLE
+#endif
@@ -22,6 +22,7 @@
 #include "debug.h"
 #include "usb_util.h"
 #include "bootloader.h"
+#include "util.h"
 
 #ifdef EE_HANDS
 #    include "eeconfig.h"
@@ -45,14 +46,28 @@
 #    define SPLIT_MAX_CONNECTION_ERRORS 10
 #endif // SPLIT_MAX_CONNECTION_ERRORS
 
-// How long (in milliseconds) to block all connection attempts after the communication has been flagged as disconnected.
-// One communication attempt will be allowed everytime this amount of time has passed since the last attempt. If that attempt succeeds, the communication is seen as working again.
+// Longest time (in milliseconds) between connection attempts once the communication has been flagged as disconnected.
+// While disconnected, a single minimal transaction probes the target, starting SPLIT_CONNECTION_CHECK_MIN_TIMEOUT after the
+// disconnect and doubling the wait after every unanswered probe up to this limit. Once a probe is answered, all state is resent.
 // Set to 0 to disable communication throttling while disconnected
 #ifndef SPLIT_CONNECTION_CHECK_TIMEOUT
 #    define SPLIT_CONNECTION_CHECK_TIMEOUT 500
 #endif // SPLIT_CONNECTION_CHECK_TIMEOUT
 
-static uint8_t connection_errors = 0;
+// Shortest time (in milliseconds) between connection attempts once the communication has been flagged as disconnected.
+#ifndef SPLIT_CONNECTION_CHECK_MIN_TIMEOUT
+#    define SPLIT_CONNECTION_CHECK_MIN_TIMEOUT 50
+#endif // SPLIT_CONNECTION_CHECK_MIN_TIMEOUT
+
+// Shortest time (in milliseconds) between attempts to reach the target while the communication is degraded.
+// While degraded, every scan starts with a probe rather than going straight to the full set of transactions,
+// and after an unanswered probe the following scans skip the split transactions until this much time has passed.
+#ifndef SPLIT_CONNECTION_DEGRADED_RETRY
+#    define SPLIT_CONNECTION_DEGRADED_RETRY 10
+#endif // SPLIT_CONNECTION_DEGRADED_RETRY
+
+static uint8_t            connection_errors = 0;
+static split_link_state_t link_state        = SPLIT_LINK_CONNECTED;
 
 volatile bool isLeftHand = true;
 
@@ -230,39 +245,86 @@ void split_post_init(void) {
 }
 
 bool is_transport_connected(void) {
-    return connection_errors < SPLIT_MAX_CONNECTION_ERRORS;
+    return link_state == SPLIT_LINK_CONNECTED || link_state == SPLIT_LINK_DEGRADED;
+}
+
+split_link_state_t split_link_state(void) {
+    return link_state;
 }
 
 bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
 #if SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
     // Throttle transaction attempts if target doesn't seem to be connected
     // Without this, a solo half becomes unusable due to constant read timeouts
-    static uint16_t connection_check_timer = 0;
-    const bool      is_disconnected        = !is_transport_connected();
-    if (is_disconnected && timer_elapsed(connection_check_timer) < SPLIT_CONNECTION_CHECK_TIMEOUT) {
-        return false;
+    static uint16_t connection_check_timer   = 0;
+    static uint16_t connection_check_timeout = MIN(SPLIT_CONNECTION_CHECK_MIN_TIMEOUT, SPLIT_CONNECTION_CHECK_TIMEOUT);
+    if (link_state == SPLIT_LINK_DISCONNECTED) {
+        if (timer_elapsed(connection_check_timer) < connection_check_timeout) {
+            return false;
+        }
+        // A full scan would stall on every transaction in turn, so only try the smallest one
+        if (!transport_probe()) {
+            connection_check_timer   = timer_read();
+            connection_check_timeout = MIN(connection_check_timeout * 2, SPLIT_CONNECTION_CHECK_TIMEOUT);
+            return false;
+        }
+        dprintln("Target answered, resyncing");
+        link_state = SPLIT_LINK_PROBING;
+        transport_resync();
     }
 #endif // SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
 
-    __attribute__((unused)) bool okay = transport_master(master_matrix, slave_matrix);
 #if SPLIT_MAX_CONNECTION_ERRORS > 0
+    // A target that stopped answering would otherwise cost a full timeout on every transaction of every scan
+    // until it is flagged as disconnected, so check it is there first and back off while it isn't
+    static uint16_t degraded_probe_timer  = 0;
+    static bool     degraded_probe_failed = false;
+    if (link_state != SPLIT_LINK_DEGRADED) {
+        degraded_probe_failed = false;
+    } else if (degraded_probe_failed && timer_elapsed(degraded_probe_timer) < SPLIT_CONNECTION_DEGRADED_RETRY) {
+        return true;
+    }
+
+    bool okay = link_state != SPLIT_LINK_DEGRADED || transport_probe();
+    if (okay) {
+        okay = transport_master(master_matrix, slave_matrix);
+    } else {
+        degraded_probe_timer  = timer_read();
+        degraded_probe_failed = true;
+    }
+
     if (!okay) {
         if (connection_errors < UINT8_MAX) {
             connection_errors++;
         }
+        if (link_state == SPLIT_LINK_PROBING || connection_errors >= SPLIT_MAX_CONNECTION_ERRORS) {
 #    if SPLIT_CONNECTION_CHECK_TIMEOUT > 0
-        bool connected = is_transport_connected();
-        if (!connected) {
             connection_check_timer = timer_read();
-            dprintln("Target disconnected, throttling connection attempts");
-        }
-        return connected;
-    } else if (is_disconnected) {
-        dprintln("Target connected");
+            if (link_state != SPLIT_LINK_PROBING) {
+                connection_check_timeout = MIN(SPLIT_CONNECTION_CHECK_MIN_TIMEOUT, SPLIT_CONNECTION_CHECK_TIMEOUT);
+                dprintln("Target disconnected, throttling connection attempts");
+            }
 #    endif // SPLIT_CONNECTION_CHECK_TIMEOUT > 0
+            link_state = SPLIT_LINK_DISCONNECTED;
+        } else if (link_state == SPLIT_LINK_CONNECTED) {
+            link_state = SPLIT_LINK_DEGRADED;
+        }
+        return is_transport_connected();
     }
 
+    if (link_state != SPLIT_LINK_CONNECTED) {
+        if (link_state != SPLIT_LINK_PROBING) {
+            // Whatever failed to go through while degraded or disconnected gets sent on the next pass
+            transport_resync();
+        }
+        if (link_state != SPLIT_LINK_DEGRADED) {
+            dprintln("Target connected");
+        }
+        link_state = SPLIT_LINK_CONNECTED;
+    }
     connection_errors = 0;
+#else
+    transport_master(master_matrix, slave_matrix);
 #endif // SPLIT_MAX_CONNECTION_ERRORS > 0
     return true;
 }
@@ -10,8 +10,16 @@ extern volatile bool isLeftHand;
 void split_pre_init(void);
 void split_post_init(void);
 
-bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
-bool is_transport_connected(void);
+typedef enum split_link_state_t {
+    SPLIT_LINK_CONNECTED,    // transactions succeed
+    SPLIT_LINK_DEGRADED,     // recent scans failed, transactions are no longer retried
+    SPLIT_LINK_DISCONNECTED, // no traffic apart from an occasional probe, backing off exponentially
+    SPLIT_LINK_PROBING,      // a probe was answered, all state is being resent
+} split_link_state_t;
+
+bool               transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+bool               is_transport_connected(void);
+split_link_state_t split_link_state(void);
 
 void split_watchdog_update(bool done);
 void split_watchdog_task(void);
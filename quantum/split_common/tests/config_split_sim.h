@@ -0,0 +1,14 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 4
+
+#define SPLIT_TRANSACTION_IDS_USER USER_SYNC_ECHO, USER_SYNC_COUNTER
+
+#define SPLIT_BULK_TRANSFER_ENABLE
+#define SPLIT_DELTA_SYNC_ENABLE
+
+#define RGB_MATRIX_LED_COUNT 16
+#define RGB_MATRIX_SPLIT {8, 8}
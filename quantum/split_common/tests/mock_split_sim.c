@@ -0,0 +1,33 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+
+// split_util.c needs a USB stack for role detection, which the simulator
+// overrides anyway.
+
+bool usb_connected_state(void) {
+    return true;
+}
+
+bool usb_vbus_state(void) {
+    return true;
+}
+
+void usb_disconnect(void) {}
+
+// The RGB matrix transaction only needs the synced config and suspend state.
+
+#include "rgb_matrix.h"
+
+rgb_config_t rgb_matrix_config;
+
+static bool rgb_matrix_suspend_state = false;
+
+bool rgb_matrix_get_suspend_state(void) {
+    return rgb_matrix_suspend_state;
+}
+
+void rgb_matrix_set_suspend_state(bool state) {
+    rgb_matrix_suspend_state = state;
+}
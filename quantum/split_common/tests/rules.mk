@@ -0,0 +1,20 @@
+split_sim_DEFS := -DSPLIT_KEYBOARD -DSPLIT_COMMON_TRANSACTIONS -DRGB_MATRIX_ENABLE
+split_sim_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_split_sim.h
+split_sim_INC := \
+	$(QUANTUM_PATH)/split_common \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+
+split_sim_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/split_sim.c \
+	$(PLATFORM_PATH)/synchronization_util.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/logging/debug.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/split_common/split_util.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/tests/mock_split_sim.c \
+	$(QUANTUM_PATH)/split_common/tests/split_sim_tests.cpp
@@ -0,0 +1,486 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <string.h>
+
+extern "C" {
+#include "split_sim.h"
+#include "split_util.h"
+#include "sync_timer.h"
+#include "transactions.h"
+#include "rgb_matrix.h"
+#include "timer.h"
+}
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+static void echo_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    const uint8_t *in  = (const uint8_t *)in_data;
+    uint8_t       *out = (uint8_t *)out_data;
+    for (uint8_t i = 0; i < in_buflen && i < out_buflen; ++i) {
+        out[i] = in[i] ^ 0xFF;
+    }
+}
+
+static uint32_t slave_counter = 0;
+
+static void counter_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    slave_counter++;
+}
+
+static uint8_t  bulk_rx_buffer[1024];
+static uint16_t bulk_rx_length   = 0;
+static int      bulk_rx_count    = 0;
+static int      bulk_tx_complete = 0;
+static bool     bulk_tx_success  = false;
+
+static void bulk_receive(uint8_t channel, const void *data, uint16_t length) {
+    bulk_rx_length = length;
+    bulk_rx_count++;
+}
+
+static void bulk_complete(uint8_t channel, bool success) {
+    bulk_tx_complete++;
+    bulk_tx_success = success;
+}
+
+class SplitSim : public ::testing::Test {
+   protected:
+    matrix_row_t master_local[HALF_ROWS]  = {0};
+    matrix_row_t master_remote[HALF_ROWS] = {0};
+    matrix_row_t slave_remote[HALF_ROWS]  = {0};
+    matrix_row_t slave_local[HALF_ROWS]   = {0};
+
+    void SetUp() override {
+        set_time(0);
+        split_sim_init();
+        memset(&rgb_matrix_config, 0, sizeof(rgb_matrix_config));
+        split_sim_register_state(&rgb_matrix_config, sizeof(rgb_matrix_config));
+        slave_counter = 0;
+        transaction_register_rpc(USER_SYNC_ECHO, echo_slave_handler);
+        transaction_register_rpc(USER_SYNC_COUNTER, counter_slave_handler);
+        split_sim_run_on_slave([](void *) { split_bulk_register_receiver(0, bulk_rx_buffer, sizeof(bulk_rx_buffer), bulk_receive); }, NULL);
+        memset(bulk_rx_buffer, 0, sizeof(bulk_rx_buffer));
+        bulk_rx_length   = 0;
+        bulk_rx_count    = 0;
+        bulk_tx_complete = 0;
+        bulk_tx_success  = false;
+        reconnect();
+    }
+
+    void scan() {
+        split_sim_slave_task(slave_remote, slave_local);
+        split_sim_master_task(master_local, master_remote);
+        advance_time(1);
+    }
+
+    void reconnect() {
+        // The connection tracking in split_util.c persists between tests
+        split_sim_set_connected(true);
+        for (int i = 0; i < 100 && split_link_state() != SPLIT_LINK_CONNECTED; ++i) {
+            advance_time(1000);
+            scan();
+        }
+        ASSERT_EQ(split_link_state(), SPLIT_LINK_CONNECTED);
+        split_sim_reset_stats();
+    }
+};
+
+TEST_F(SplitSim, SlaveMatrixReachesMaster) {
+    slave_local[0] = 0x05;
+    slave_local[1] = 0x80;
+    scan();
+    EXPECT_EQ(master_remote[0], 0x05);
+    EXPECT_EQ(master_remote[1], 0x80);
+
+    slave_local[0] = 0;
+    scan();
+    EXPECT_EQ(master_remote[0], 0);
+}
+
+TEST_F(SplitSim, SyncTimerFollowsMaster) {
+    split_sim_set_slave_clock(12345, 0);
+    advance_time(100); // FORCED_SYNC_THROTTLE_MS
+    scan();
+    // The slave only applies the received timer on its next scan
+    scan();
+
+    static uint32_t slave_sync_time;
+    split_sim_run_on_slave([](void *) { slave_sync_time = sync_timer_read32(); }, NULL);
+    uint32_t master_time = sync_timer_read32();
+    EXPECT_LE((int32_t)(master_time - slave_sync_time), 3);
+    EXPECT_GE((int32_t)(master_time - slave_sync_time), -3);
+}
+
+static uint32_t read_slave_sync_timer(void) {
+    static uint32_t value;
+    split_sim_run_on_slave([](void *) { value = sync_timer_read32(); }, NULL);
+    return value;
+}
+
+TEST_F(SplitSim, SyncTimerTracksSkewBetweenRareUpdates) {
+    // Slave crystal runs 0.5% fast, which would be 5ms of drift per second
+    split_sim_set_slave_clock(-4321, 5000);
+
+    // Let the estimate settle
+    for (int i = 0; i < 20000; ++i) {
+        scan();
+    }
+
+    split_sim_reset_stats();
+    uint32_t last_slave = read_slave_sync_timer();
+    int32_t  worst      = 0;
+    for (int i = 0; i < 10000; ++i) {
+        scan();
+        uint32_t slave = read_slave_sync_timer();
+        int32_t  error = (int32_t)(sync_timer_read32() - slave);
+        if (error < 0) error = -error;
+        if (error > worst) worst = error;
+        // Never jumps backwards, and never leaps forwards
+        EXPECT_GE((int32_t)(slave - last_slave), 0);
+        EXPECT_LE((int32_t)(slave - last_slave), 3);
+        last_slave = slave;
+    }
+    EXPECT_LE(worst, 2);
+
+    // Roughly one sync per second rather than one every FORCED_SYNC_THROTTLE_MS
+    split_sim_link_stats_t stats;
+    split_sim_get_stats(&stats);
+    EXPECT_LE(stats.by_id[PUT_SYNC_TIMER], 12);
+}
+
+TEST_F(SplitSim, SyncTimerRelocksAfterReconnect) {
+    split_sim_set_slave_clock(1000, 5000);
+    for (int i = 0; i < 20000; ++i) {
+        scan();
+    }
+
+    // The slave reboots while unplugged, losing its estimate of the master clock
+    split_sim_set_connected(false);
+    for (int i = 0; i < 10; ++i) {
+        scan();
+    }
+    split_sim_run_on_slave([](void *) { sync_timer_init(); }, NULL);
+    reconnect();
+
+    // Back to syncing every FORCED_SYNC_THROTTLE_MS until the slave locks on again
+    for (int i = 0; i < 350; ++i) {
+        scan();
+    }
+    split_sim_link_stats_t stats;
+    split_sim_get_stats(&stats);
+    EXPECT_GE(stats.by_id[PUT_SYNC_TIMER], 3);
+
+    // The skew estimate starts over, but converges again
+    for (int i = 0; i < 20000; ++i) {
+        scan();
+    }
+    int32_t error = (int32_t)(sync_timer_read32() - read_slave_sync_timer());
+    EXPECT_LE(error, 2);
+    EXPECT_GE(error, -2);
+}
+
+TEST_F(SplitSim, RpcRoundTrip) {
+    uint8_t out[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint8_t in[8]  = {0};
+    EXPECT_TRUE(transaction_rpc_exec(USER_SYNC_ECHO, sizeof(out), out, sizeof(in), in));
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(in[i], out[i] ^ 0xFF);
+    }
+
+    EXPECT_TRUE(transaction_rpc_send(USER_SYNC_COUNTER, 0, NULL));
+    EXPECT_EQ(slave_counter, 1);
+}
+
+TEST_F(SplitSim, LinkTimeFollowsBaud) {
+    split_sim_link_config_t link;
+    split_sim_get_link(&link);
+    link.baud       = 100000;
+    link.latency_us = 0;
+    split_sim_set_link(&link);
+
+    uint8_t out[20] = {0};
+    EXPECT_TRUE(transaction_rpc_send(USER_SYNC_COUNTER, sizeof(out), out));
+
+    split_sim_link_stats_t stats;
+    split_sim_get_stats(&stats);
+    EXPECT_EQ(stats.transactions, 4);
+    EXPECT_EQ(stats.failed, 0);
+    // Every byte on the wire costs 100us at 100kbaud
+    EXPECT_EQ(stats.link_time_us, (uint64_t)(stats.bytes_to_slave + stats.bytes_to_master) * 100);
+}
+
+TEST_F(SplitSim, DisconnectIsDetectedAndRecovered) {
+    split_sim_set_connected(false);
+    // SPLIT_MAX_CONNECTION_ERRORS failed attempts, SPLIT_CONNECTION_DEGRADED_RETRY apart
+    uint32_t start = timer_read32();
+    while (is_transport_connected() && timer_elapsed32(start) < 1000) {
+        scan();
+    }
+    EXPECT_FALSE(is_transport_connected());
+    EXPECT_LE(timer_elapsed32(start), 200);
+
+    // Reconnection attempts only wait for the short probe timeout, not a full transaction timeout
+    uint32_t worst = 0;
+    start          = timer_read32();
+    while (timer_elapsed32(start) < 2000) {
+        uint32_t before = timer_read32();
+        scan();
+        worst = MAX(worst, timer_elapsed32(before));
+    }
+    EXPECT_LE(worst, SPLIT_CONNECTION_PROBE_TIMEOUT + 1);
+
+    reconnect();
+    slave_local[0] = 0x11;
+    scan();
+    EXPECT_EQ(master_remote[0], 0x11);
+}
+
+TEST_F(SplitSim, CorruptedMatrixIsNotAccepted) {
+    slave_local[0] = 0x0F;
+    scan();
+    ASSERT_EQ(master_remote[0], 0x0F);
+
+    split_sim_link_config_t link;
+    split_sim_get_link(&link);
+    link.corrupt_one_in = 1;
+    split_sim_set_link(&link);
+
+    slave_local[0] = 0xF0;
+    for (int i = 0; i < 5; ++i) {
+        scan();
+        EXPECT_EQ(master_remote[0], 0x0F);
+    }
+
+    split_sim_link_stats_t stats;
+    split_sim_get_stats(&stats);
+    EXPECT_GT(stats.corrupted_bytes, 0);
+}
+
+TEST_F(SplitSim, BulkTransferDelivers) {
+    static uint8_t payload[1000];
+    for (size_t i = 0; i < sizeof(payload); ++i) {
+        payload[i] = (uint8_t)(i * 7);
+    }
+
+    ASSERT_TRUE(split_bulk_send(0, payload, sizeof(payload), bulk_complete));
+    EXPECT_FALSE(split_bulk_send(0, payload, sizeof(payload), bulk_complete));
+
+    int scans = 0;
+    while (bulk_tx_complete == 0 && scans < 1000) {
+        scan();
+        ++scans;
+    }
+    scan();
+
+    EXPECT_EQ(bulk_tx_complete, 1);
+    EXPECT_TRUE(bulk_tx_success);
+    EXPECT_EQ(bulk_rx_length, sizeof(payload));
+    EXPECT_EQ(memcmp(bulk_rx_buffer, payload, sizeof(payload)), 0);
+    // One full window of chunks goes out per scan, bar the odd scan taken by a periodic sync
+    // and the one a freshly booted master spends asking the slave for its last transfer id
+    EXPECT_LE(scans, (int)(sizeof(payload) / SPLIT_BULK_WINDOW / SPLIT_BULK_CHUNK_SIZE) + 3);
+}
+
+TEST_F(SplitSim, BulkTransferSurvivesErrorsAndReconnects) {
+    static uint8_t payload[600];
+    for (size_t i = 0; i < sizeof(payload); ++i) {
+        payload[i] = (uint8_t)(i ^ 0x5A);
+    }
+
+    split_sim_link_config_t link;
+    split_sim_get_link(&link);
+    link.corrupt_one_in = 500;
+    split_sim_set_link(&link);
+
+    ASSERT_TRUE(split_bulk_send(0, payload, sizeof(payload), bulk_complete));
+    for (int i = 0; i < 3; ++i) {
+        scan();
+    }
+
+    // Pull the cable halfway through, the transfer resumes where the slave left off
+    split_sim_set_connected(false);
+    for (int i = 0; i < 10; ++i) {
+        scan();
+    }
+    reconnect();
+
+    for (int i = 0; i < 1000 && bulk_tx_complete == 0; ++i) {
+        scan();
+    }
+    scan();
+
+    EXPECT_EQ(bulk_tx_complete, 1);
+    EXPECT_TRUE(bulk_tx_success);
+    EXPECT_EQ(bulk_rx_length, sizeof(payload));
+    EXPECT_EQ(memcmp(bulk_rx_buffer, payload, sizeof(payload)), 0);
+}
+
+TEST_F(SplitSim, BulkTransferDeliversOnceWhenAcksAreLost) {
+    static uint8_t payload[SPLIT_BULK_CHUNK_SIZE];
+
+    split_sim_link_config_t link;
+    split_sim_get_link(&link);
+    link.drop_one_in = 10;
+    split_sim_set_link(&link);
+
+    // Single chunk transfers are resent from their first chunk whenever the acknowledgement is lost
+    int sent = 0;
+    for (int n = 0; n < 50; ++n) {
+        memset(payload, n, sizeof(payload));
+        bulk_tx_complete = 0;
+        ASSERT_TRUE(split_bulk_send(0, payload, sizeof(payload), bulk_complete));
+        for (int i = 0; i < 1000 && bulk_tx_complete == 0; ++i) {
+            scan();
+        }
+        ASSERT_EQ(bulk_tx_complete, 1);
+        if (bulk_tx_success) {
+            sent++;
+        }
+    }
+    scan();
+
+    split_sim_link_stats_t stats;
+    split_sim_get_stats(&stats);
+    EXPECT_GT(stats.failed, 0);
+    EXPECT_GT(sent, 0);
+    EXPECT_EQ(bulk_rx_count, sent);
+}
+
+TEST_F(SplitSim, BulkTransferWaitsForQuietScans) {
+    static uint8_t payload[256];
+    for (size_t i = 0; i < sizeof(payload); ++i) {
+        payload[i] = (uint8_t)(i * 3);
+    }
+
+    ASSERT_TRUE(split_bulk_send(0, payload, sizeof(payload), bulk_complete));
+
+    // The slave matrix changes on every scan, so there is never a scan without a regular sync to make
+    for (int i = 0; i < 100; ++i) {
+        slave_local[0] = (matrix_row_t)(i + 1);
+        scan();
+        EXPECT_EQ(master_remote[0], (matrix_row_t)(i + 1));
+    }
+    EXPECT_EQ(bulk_tx_complete, 0);
+
+    split_sim_link_stats_t stats;
+    split_sim_get_stats(&stats);
+    EXPECT_EQ(stats.by_id[PUT_BULK_CHUNK], 0);
+
+    for (int i = 0; i < 100 && bulk_tx_complete == 0; ++i) {
+        scan();
+    }
+    scan();
+
+    EXPECT_EQ(bulk_tx_complete, 1);
+    EXPECT_TRUE(bulk_tx_success);
+    EXPECT_EQ(memcmp(bulk_rx_buffer, payload, sizeof(payload)), 0);
+}
+
+static rgb_config_t read_slave_rgb_matrix_config(void) {
+    static rgb_config_t value;
+    split_sim_run_on_slave([](void *) { value = rgb_matrix_config; }, NULL);
+    return value;
+}
+
+TEST_F(SplitSim, RgbMatrixHueStepsAreSentAsDeltas) {
+    rgb_matrix_config.enable = 1;
+    rgb_matrix_config.mode   = 3;
+    rgb_matrix_config.hsv    = (HSV){10, 255, 200};
+    scan();
+    scan();
+    ASSERT_EQ(read_slave_rgb_matrix_config().raw, rgb_matrix_config.raw);
+
+    split_sim_reset_stats();
+    for (int i = 0; i < 20; ++i) {
+        rgb_matrix_config.hsv.h += 8;
+        scan();
+        // The slave applies the update on its next scan
+        scan();
+        EXPECT_EQ(read_slave_rgb_matrix_config().raw, rgb_matrix_config.raw);
+    }
+
+    split_sim_link_stats_t stats;
+    split_sim_get_stats(&stats);
+    EXPECT_EQ(stats.by_id[PUT_DELTA_SYNC], 20);
+    EXPECT_LE(stats.by_id[PUT_RGB_MATRIX], 1);
+}
+
+TEST_F(SplitSim, RgbMatrixLargeChangesAndCorruptionRecover) {
+    // Too many changed bytes for a delta, the whole struct is sent instead
+    rgb_matrix_config.enable = 1;
+    rgb_matrix_config.mode   = 7;
+    rgb_matrix_config.hsv    = (HSV){1, 2, 3};
+    rgb_matrix_config.speed  = 4;
+    rgb_matrix_config.flags  = 5;
+    scan();
+    scan();
+    EXPECT_EQ(read_slave_rgb_matrix_config().raw, rgb_matrix_config.raw);
+
+    split_sim_link_config_t link;
+    split_sim_get_link(&link);
+    link.corrupt_one_in = 20;
+    split_sim_set_link(&link);
+    for (int i = 0; i < 50; ++i) {
+        rgb_matrix_config.hsv.h++;
+        scan();
+    }
+
+    // Rejected deltas are repaired by the periodic full resync
+    link.corrupt_one_in = 0;
+    split_sim_set_link(&link);
+    for (int i = 0; i < 150; ++i) {
+        scan();
+    }
+    EXPECT_EQ(read_slave_rgb_matrix_config().raw, rgb_matrix_config.raw);
+}
+
+TEST_F(SplitSim, UnpluggedHalfNeverStallsTheScan) {
+    split_sim_link_config_t link;
+    split_sim_get_link(&link);
+    rgb_matrix_config.hsv = (HSV){20, 30, 40};
+    scan();
+    scan();
+
+    split_sim_set_connected(false);
+    bool     saw_degraded = false;
+    uint32_t worst        = 0;
+    uint32_t start        = timer_read32();
+    while (timer_elapsed32(start) < 5000) {
+        uint32_t before = timer_read32();
+        scan();
+        worst = MAX(worst, timer_elapsed32(before));
+        saw_degraded |= split_link_state() == SPLIT_LINK_DEGRADED;
+    }
+    EXPECT_TRUE(saw_degraded);
+    EXPECT_EQ(split_link_state(), SPLIT_LINK_DISCONNECTED);
+    // At most one handshake timeout per scan, on top of the scan itself
+    EXPECT_LE(worst, link.timeout_ms + 2);
+
+    // The slave half was power cycled while unplugged and lost everything
+    split_sim_run_on_slave(
+        [](void *) {
+            memset(split_shmem, 0, sizeof(split_shared_memory_t));
+            memset(&rgb_matrix_config, 0, sizeof(rgb_matrix_config));
+        },
+        NULL);
+
+    split_sim_set_connected(true);
+    start = timer_read32();
+    while (!is_transport_connected() && timer_elapsed32(start) < 2000) {
+        scan();
+    }
+    ASSERT_TRUE(is_transport_connected());
+    // Probes back off to SPLIT_CONNECTION_CHECK_TIMEOUT at most
+    EXPECT_LE(timer_elapsed32(start), 500 + link.timeout_ms + 2);
+
+    // Everything was resent straight away rather than on the next forced sync
+    scan();
+    EXPECT_EQ(read_slave_rgb_matrix_config().raw, rgb_matrix_config.raw);
+}
@@ -0,0 +1 @@
+TEST_LIST += split_sim
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "split_delta_sync.h"
+
 enum serial_transaction_id {
 #ifdef USE_I2C
     I2C_EXECUTE_CALLBACK,
@@ -67,6 +69,10 @@ enum serial_transaction_id {
     PUT_RGB_MATRIX,
 #endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
+#ifdef SPLIT_DELTA_SYNC_ENABLE
+    PUT_DELTA_SYNC,
+#endif // SPLIT_DELTA_SYNC_ENABLE
+
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
     PUT_WPM,
 #endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
@@ -97,6 +103,11 @@ enum serial_transaction_id {
     PUT_ACTIVITY,
 #endif // SPLIT_ACTIVITY_ENABLE
 
+#if defined(SPLIT_BULK_TRANSFER_ENABLE)
+    PUT_BULK_CHUNK,
+    GET_BULK_ACK,
+#endif // defined(SPLIT_BULK_TRANSFER_ENABLE)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     PUT_RPC_INFO,
     PUT_RPC_REQ_DATA,
@@ -65,12 +65,16 @@
 #    include "wpm.h"
 #endif
 
-#define SYNC_TIMER_OFFSET 2
-
 #ifndef FORCED_SYNC_THROTTLE_MS
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
 
+// Max time (in milliseconds) a transaction may keep being retried within one scan.
+// Retries recover from line noise, but a link that is timing out won't come back within them.
+#ifndef SPLIT_TRANSACTION_RETRY_BUDGET_MS
+#    define SPLIT_TRANSACTION_RETRY_BUDGET_MS 5
+#endif // SPLIT_TRANSACTION_RETRY_BUDGET_MS
+
 #define sizeof_member(type, member) sizeof(((type *)NULL)->member)
 
 #define trans_initiator2target_initializer_cb(member, cb) \
@@ -84,9 +88,12 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+// Whether anything other than the checksum polls made every scan went out during the current transactions_master() pass
+static bool transactions_sent = false;
+
+#define transport_write(id, data, length) (transactions_sent = true, transport_execute_transaction(id, data, length, NULL, 0))
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#define transport_exec(id) (transactions_sent = true, transport_execute_transaction(id, NULL, 0, NULL, 0))
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -97,10 +104,17 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 ////////////////////////////////////////////////////
 // Helpers
 
+// Set when the link comes back, forces every transaction to resend until a full pass succeeds
+static bool resync_pending = false;
+
 static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
-    int num_retries = is_transport_connected() ? 10 : 1;
+    int      num_retries = split_link_state() == SPLIT_LINK_CONNECTED ? 10 : 1;
+    uint16_t start       = timer_read();
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
+            if (timer_elapsed(start) >= SPLIT_TRANSACTION_RETRY_BUDGET_MS) {
+                break;
+            }
             for (int i = 0; i < iter * iter; ++i) {
                 wait_us(10);
             }
@@ -144,10 +158,15 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+inline static bool forced_sync_due(uint32_t last_update, uint32_t interval) {
+    return resync_pending || timer_elapsed32(last_update) >= interval;
+}
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
-    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
+    if (okay && (forced_sync_due(*last_update, FORCED_SYNC_THROTTLE_MS) || curr_checksum != crc8(equiv_shmem, length))) {
+        transactions_sent = true;
         okay &= transport_read(trans_id_retrieve, destination, length);
         okay &= curr_checksum == crc8(equiv_shmem, length);
         if (okay) {
@@ -161,7 +180,7 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
+    if (forced_sync_due(*last_update, FORCED_SYNC_THROTTLE_MS) || condition) {
         okay &= transport_write(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
@@ -175,6 +194,143 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+////////////////////////////////////////////////////
+// Delta updates
+
+#ifdef SPLIT_DELTA_SYNC_ENABLE
+
+#    define DELTA_SYNC_BLOCKS (sizeof(split_delta_map_t) * 8)
+#    define DELTA_SYNC_HEADER_SIZE (offsetof(split_delta_sync_t, payload.data))
+
+// Serial transactions always transfer the whole buffer, whereas I2C only writes what was used
+#    ifdef USE_I2C
+#        define delta_sync_wire_size(used) (used)
+#    else
+#        define delta_sync_wire_size(used) sizeof(split_delta_sync_t)
+#    endif
+
+inline static size_t delta_sync_block_size(size_t length) {
+    return (length + DELTA_SYNC_BLOCKS - 1) / DELTA_SYNC_BLOCKS;
+}
+
+inline static uint8_t delta_sync_checksum(const split_delta_sync_t *delta, size_t used) {
+    return crc8(&delta->payload, used - offsetof(split_delta_sync_t, payload));
+}
+
+/**
+ * @brief Packs the blocks of `source` that differ from `previous` into `delta`.
+ * Returns the number of bytes of `delta` in use, or 0 if the changes don't fit
+ * or wouldn't take fewer bytes on the wire than sending `source` outright.
+ */
+static size_t delta_sync_encode(split_delta_sync_t *delta, int8_t trans_id, const void *source, const void *previous, size_t length) {
+    const uint8_t *src   = (const uint8_t *)source;
+    const uint8_t *prev  = (const uint8_t *)previous;
+    size_t         block = delta_sync_block_size(length);
+    size_t         used  = 0;
+
+    delta->payload.transaction_id = trans_id;
+    delta->payload.changed        = 0;
+    for (uint8_t i = 0; i < DELTA_SYNC_BLOCKS && i * block < length; ++i) {
+        size_t offset = i * block;
+        size_t count  = (length - offset) < block ? (length - offset) : block;
+        if (memcmp(&src[offset], &prev[offset], count) == 0) {
+            continue;
+        }
+        if (used + count > SPLIT_DELTA_MAX_PAYLOAD) {
+            return 0;
+        }
+        delta->payload.changed |= (split_delta_map_t)1 << i;
+        memcpy(&delta->payload.data[used], &src[offset], count);
+        used += count;
+    }
+
+    used += DELTA_SYNC_HEADER_SIZE;
+    if (delta->payload.changed == 0 || delta_sync_wire_size(used) >= length) {
+        return 0;
+    }
+    delta->checksum = delta_sync_checksum(delta, used);
+    return used;
+}
+
+/**
+ * @brief Variant of send_if_condition() for transactions whose data is a plain
+ * copy in split shared memory. Only the blocks that differ from the last
+ * transmission are sent, falling back to the whole struct when that is
+ * cheaper, and the whole struct is still resent every FORCED_SYNC_THROTTLE_MS
+ * so the slave recovers from any missed update.
+ */
+static bool send_delta_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, const void *source, void *equiv_shmem, size_t length) {
+    if (forced_sync_due(*last_update, FORCED_SYNC_THROTTLE_MS) || !condition) {
+        return send_if_condition(trans_id, last_update, false, (void *)source, length);
+    }
+
+    split_delta_sync_t delta;
+    size_t             used = delta_sync_encode(&delta, trans_id, source, equiv_shmem, length);
+    if (used == 0) {
+        return send_if_condition(trans_id, last_update, true, (void *)source, length);
+    }
+
+    bool okay = transport_write(PUT_DELTA_SYNC, &delta, used);
+    if (okay) {
+        memcpy(equiv_shmem, source, length);
+    }
+    return okay;
+}
+
+inline static bool send_delta_if_data_mismatch(int8_t trans_id, uint32_t *last_update, const void *source, void *equiv_shmem, size_t length) {
+    return send_delta_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, equiv_shmem, length);
+}
+
+static void delta_sync_handlers_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_delta_sync_t *delta = (const split_delta_sync_t *)initiator2target_buffer;
+    int8_t                    id    = delta->payload.transaction_id;
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS || id == PUT_DELTA_SYNC) {
+        return;
+    }
+
+    split_transaction_desc_t *trans  = &split_transaction_table[id];
+    size_t                    length = trans->initiator2target_buffer_size;
+    size_t                    block  = delta_sync_block_size(length);
+    size_t                    used   = 0;
+
+    // Validate everything before touching the target buffer
+    for (uint8_t i = 0; i < DELTA_SYNC_BLOCKS; ++i) {
+        if (delta->payload.changed & ((split_delta_map_t)1 << i)) {
+            size_t offset = i * block;
+            if (offset >= length) {
+                return;
+            }
+            used += (length - offset) < block ? (length - offset) : block;
+        }
+    }
+    if (used == 0 || used > SPLIT_DELTA_MAX_PAYLOAD || delta->checksum != delta_sync_checksum(delta, used + DELTA_SYNC_HEADER_SIZE)) {
+        return;
+    }
+
+    uint8_t       *target = split_trans_initiator2target_buffer(trans);
+    const uint8_t *data   = delta->payload.data;
+    for (uint8_t i = 0; i < DELTA_SYNC_BLOCKS; ++i) {
+        if (delta->payload.changed & ((split_delta_map_t)1 << i)) {
+            size_t offset = i * block;
+            size_t count  = (length - offset) < block ? (length - offset) : block;
+            memcpy(&target[offset], data, count);
+            data += count;
+        }
+    }
+
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+}
+
+#    define TRANSACTIONS_DELTA_SYNC_REGISTRATIONS [PUT_DELTA_SYNC] = trans_initiator2target_initializer_cb(delta_sync, delta_sync_handlers_slave_callback),
+
+#else // SPLIT_DELTA_SYNC_ENABLE
+
+#    define TRANSACTIONS_DELTA_SYNC_REGISTRATIONS
+
+#endif // SPLIT_DELTA_SYNC_ENABLE
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
@@ -296,31 +452,66 @@ static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, c
 
 #ifndef DISABLE_SYNC_TIMER
 
+// How often (in milliseconds) the master clock is sent once the slave has locked onto it
+#    ifndef SYNC_TIMER_INTERVAL_MS
+#        define SYNC_TIMER_INTERVAL_MS 1000
+#    endif // SYNC_TIMER_INTERVAL_MS
+
 static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
+    static uint32_t last_update  = 0;
+    static uint32_t last_rtt     = 0;
+    static bool     slave_locked = false;
+
+    // A reconnected slave may have rebooted or drifted while away, so don't trust its lock until it reports again
+    if (resync_pending) {
+        slave_locked = false;
+    }
+
+    // Sync often until the slave has a stable estimate, after which its skew tracking carries it between rare updates
+    uint32_t interval = slave_locked ? SYNC_TIMER_INTERVAL_MS : FORCED_SYNC_THROTTLE_MS;
 
     bool okay = true;
-    if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
-        uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+    if (forced_sync_due(last_update, interval)) {
+        uint32_t start       = timer_read32();
+        uint32_t master_time = sync_timer_read32() + (last_rtt / 2);
+        bool     locked      = false;
+        transactions_sent    = true;
+        okay &= transport_execute_transaction(PUT_SYNC_TIMER, &master_time, sizeof(master_time), &locked, sizeof(locked));
         if (okay) {
-            last_update = timer_read32();
+            last_update  = timer_read32();
+            last_rtt     = TIMER_DIFF_32(last_update, start);
+            slave_locked = locked;
+        } else {
+            slave_locked = false;
         }
     }
     return okay;
 }
 
+static void sync_timer_handlers_slave_receive(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    // Stamp the arrival as close to the wire as possible, the main loop may only get to it much later
+    split_shmem->sync_timer.receive_time = timer_read32();
+}
+
 static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_sync_timer = 0;
-    if (last_sync_timer != split_shmem->sync_timer) {
-        last_sync_timer = split_shmem->sync_timer;
-        sync_timer_update(last_sync_timer);
+    if (last_sync_timer != split_shmem->sync_timer.master_time) {
+        last_sync_timer = split_shmem->sync_timer.master_time;
+        sync_timer_sample(last_sync_timer, split_shmem->sync_timer.receive_time);
     }
+    split_shmem->sync_timer.locked = sync_timer_is_locked();
 }
 
+// clang-format off
 #    define TRANSACTIONS_SYNC_TIMER_MASTER() TRANSACTION_HANDLER_MASTER(sync_timer)
 #    define TRANSACTIONS_SYNC_TIMER_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(sync_timer)
-#    define TRANSACTIONS_SYNC_TIMER_REGISTRATIONS [PUT_SYNC_TIMER] = trans_initiator2target_initializer(sync_timer),
+#    define TRANSACTIONS_SYNC_TIMER_REGISTRATIONS \
+    [PUT_SYNC_TIMER] = { \
+        sizeof_member(split_shared_memory_t, sync_timer.master_time), offsetof(split_shared_memory_t, sync_timer.master_time), \
+        sizeof_member(split_shared_memory_t, sync_timer.locked), offsetof(split_shared_memory_t, sync_timer.locked), \
+        sync_timer_handlers_slave_receive \
+    },
+// clang-format on
 
 #else // DISABLE_SYNC_TIMER
 
@@ -402,7 +593,7 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update    = 0;
-    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    bool              mods_need_sync = forced_sync_due(last_update, FORCED_SYNC_THROTTLE_MS);
     split_mods_sync_t new_mods;
     new_mods.real_mods = get_mods();
     if (!mods_need_sync && new_mods.real_mods != split_shmem->mods.real_mods) {
@@ -501,9 +692,12 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update = 0;
     rgblight_syncinfo_t rgblight_sync;
+    memset(&rgblight_sync, 0, sizeof(rgblight_sync)); // padding is compared against the last transmission
     rgblight_get_syncinfo(&rgblight_sync);
-    if (send_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
+    if (send_delta_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, &split_shmem->rgblight_sync, sizeof(rgblight_sync))) {
         rgblight_clear_change_flags();
+        // The slave clears its copy once applied, mirror that so the next change always carries its flags
+        split_shmem->rgblight_sync.status.change_flags = 0;
     } else {
         return false;
     }
@@ -543,9 +737,10 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 static bool led_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update = 0;
     led_matrix_sync_t led_matrix_sync;
+    memset(&led_matrix_sync, 0, sizeof(led_matrix_sync)); // padding is compared against the last transmission
     memcpy(&led_matrix_sync.led_matrix, &led_matrix_eeconfig, sizeof(led_eeconfig_t));
     led_matrix_sync.led_suspend_state = led_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_LED_MATRIX, &last_update, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
+    return send_delta_if_data_mismatch(PUT_LED_MATRIX, &last_update, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
 }
 
 static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -577,9 +772,10 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update = 0;
     rgb_matrix_sync_t rgb_matrix_sync;
+    memset(&rgb_matrix_sync, 0, sizeof(rgb_matrix_sync)); // padding is compared against the last transmission
     memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+    return send_delta_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
 }
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -914,6 +1110,246 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Bulk transfers
+
+#if defined(SPLIT_BULK_TRANSFER_ENABLE)
+
+typedef struct {
+    const uint8_t                 *data;
+    uint16_t                       length;
+    uint16_t                       acked_offset;
+    uint8_t                        transfer_id;
+    uint8_t                        retries;
+    bool                           active;
+    bool                           synced;
+    split_bulk_complete_callback_t callback;
+} split_bulk_tx_t;
+
+typedef struct {
+    uint8_t                      *buffer;
+    uint16_t                      buffer_size;
+    uint16_t                      total_length;
+    uint16_t                      next_offset;
+    uint8_t                       transfer_id;
+    bool                          complete;
+    split_bulk_receive_callback_t callback;
+} split_bulk_rx_t;
+
+static split_bulk_tx_t bulk_tx[SPLIT_BULK_CHANNELS];
+static split_bulk_rx_t bulk_rx[SPLIT_BULK_CHANNELS];
+
+// Zero is reserved for querying the slave, which is also what a freshly booted slave has last received
+static void bulk_tx_next_id(split_bulk_tx_t *tx) {
+    if (++tx->transfer_id == 0) {
+        tx->transfer_id = 1;
+    }
+}
+
+static void bulk_tx_finish(uint8_t channel, bool success) {
+    split_bulk_tx_t *tx = &bulk_tx[channel];
+    tx->active          = false;
+    if (tx->callback) {
+        tx->callback(channel, success);
+    }
+}
+
+bool split_bulk_send(uint8_t channel, const void *data, uint16_t length, split_bulk_complete_callback_t callback) {
+    if (!is_keyboard_master() || channel >= SPLIT_BULK_CHANNELS || bulk_tx[channel].active || !data || !length) {
+        return false;
+    }
+
+    split_bulk_tx_t *tx = &bulk_tx[channel];
+    tx->data            = data;
+    tx->length          = length;
+    tx->acked_offset    = 0;
+    tx->retries         = 0;
+    tx->callback        = callback;
+    if (tx->synced) {
+        bulk_tx_next_id(tx);
+    }
+    tx->active = true;
+    return true;
+}
+
+bool split_bulk_is_busy(uint8_t channel) {
+    return channel < SPLIT_BULK_CHANNELS && bulk_tx[channel].active;
+}
+
+void split_bulk_cancel(uint8_t channel) {
+    if (split_bulk_is_busy(channel)) {
+        bulk_tx_finish(channel, false);
+    }
+}
+
+void split_bulk_register_receiver(uint8_t channel, void *buffer, uint16_t buffer_size, split_bulk_receive_callback_t callback) {
+    if (channel >= SPLIT_BULK_CHANNELS) return;
+
+    split_shared_memory_lock();
+    split_bulk_rx_t *rx = &bulk_rx[channel];
+    rx->buffer          = buffer;
+    rx->buffer_size     = buffer_size;
+    rx->callback        = callback;
+    rx->total_length    = 0;
+    rx->next_offset     = 0;
+    rx->complete        = false;
+    split_shared_memory_unlock();
+}
+
+static bool bulk_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t next_channel = 0;
+
+    // Only ever uses scans where no regular sync needed sending, and never blocks on a dead link
+    if (!is_transport_connected() || transactions_sent) {
+        return true;
+    }
+
+    split_bulk_tx_t *tx      = NULL;
+    uint8_t          channel = 0;
+    for (uint8_t i = 0; i < SPLIT_BULK_CHANNELS; ++i) {
+        channel = (next_channel + i) % SPLIT_BULK_CHANNELS;
+        if (bulk_tx[channel].active) {
+            tx = &bulk_tx[channel];
+            break;
+        }
+    }
+    if (!tx) {
+        return true;
+    }
+    next_channel = (channel + 1) % SPLIT_BULK_CHANNELS;
+
+    if (tx->retries >= SPLIT_BULK_MAX_RETRIES) {
+        dprintf("Bulk transfer on channel %d stalled\n", (int)channel);
+        bulk_tx_finish(channel, false);
+        return true;
+    }
+    tx->retries++;
+
+    split_bulk_chunk_t chunk;
+    split_bulk_ack_t   ack;
+
+    // The slave drops a first chunk carrying the id it last received as a resend. After booting, the master
+    // asks for that id first so that its own count, which starts again from zero, picks up after it.
+    if (!tx->synced) {
+        memset(&chunk, 0, sizeof(chunk));
+        chunk.payload.channel = channel;
+        chunk.checksum        = crc8(&chunk.payload, sizeof(chunk.payload));
+        if (transport_write(PUT_BULK_CHUNK, &chunk, sizeof(chunk)) && transport_read(GET_BULK_ACK, &ack, sizeof(ack)) && ack.checksum == crc8(&ack.payload, sizeof(ack.payload)) && ack.payload.channel == channel) {
+            tx->transfer_id = ack.payload.transfer_id;
+            bulk_tx_next_id(tx);
+            tx->synced  = true;
+            tx->retries = 0;
+        }
+        return true;
+    }
+
+    // Send a window of chunks starting from whatever the slave last acknowledged,
+    // so lost or corrupted chunks are simply resent on the next pass
+    uint16_t offset = tx->acked_offset;
+    for (uint8_t i = 0; i < SPLIT_BULK_WINDOW && offset < tx->length; ++i) {
+        uint16_t remaining = tx->length - offset;
+        // Padding and the unused tail of the last chunk are covered by the checksum too, so keep them deterministic
+        memset(&chunk, 0, sizeof(chunk));
+        chunk.payload.channel      = channel;
+        chunk.payload.transfer_id  = tx->transfer_id;
+        chunk.payload.total_length = tx->length;
+        chunk.payload.offset       = offset;
+        chunk.payload.length       = remaining < SPLIT_BULK_CHUNK_SIZE ? remaining : SPLIT_BULK_CHUNK_SIZE;
+        memcpy(chunk.payload.data, &tx->data[offset], chunk.payload.length);
+        chunk.checksum = crc8(&chunk.payload, sizeof(chunk.payload));
+        if (!transport_write(PUT_BULK_CHUNK, &chunk, sizeof(chunk))) {
+            break;
+        }
+        offset += chunk.payload.length;
+    }
+
+    if (!transport_read(GET_BULK_ACK, &ack, sizeof(ack)) || ack.checksum != crc8(&ack.payload, sizeof(ack.payload))) {
+        return true;
+    }
+    if (ack.payload.channel == channel && ack.payload.transfer_id == tx->transfer_id && ack.payload.next_offset > tx->acked_offset) {
+        tx->acked_offset = ack.payload.next_offset;
+        tx->retries      = 0;
+        if (tx->acked_offset >= tx->length) {
+            bulk_tx_finish(channel, true);
+        }
+    }
+    return true;
+}
+
+static void bulk_handlers_slave_chunk(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_bulk_chunk_t *chunk = &split_shmem->bulk_chunk;
+    if (crc8(&chunk->payload, sizeof(chunk->payload)) != chunk->checksum || chunk->payload.channel >= SPLIT_BULK_CHANNELS) {
+        return;
+    }
+
+    split_bulk_rx_t *rx = &bulk_rx[chunk->payload.channel];
+    if (!rx->buffer || chunk->payload.total_length > rx->buffer_size || chunk->payload.length > SPLIT_BULK_CHUNK_SIZE) {
+        return;
+    }
+
+    // Id zero only asks for the last id received, which the acknowledgement below carries
+    if (chunk->payload.transfer_id != 0) {
+        // A first chunk with a new id starts a transfer. One with the current id is a resend whose
+        // acknowledgement was lost, so restarting on it would deliver the same payload twice.
+        if (chunk->payload.offset == 0 && chunk->payload.transfer_id != rx->transfer_id) {
+            rx->transfer_id  = chunk->payload.transfer_id;
+            rx->total_length = chunk->payload.total_length;
+            rx->next_offset  = 0;
+            rx->complete     = false;
+        } else if (chunk->payload.transfer_id != rx->transfer_id) {
+            // The rest of a transfer is only accepted after its first chunk
+            return;
+        }
+
+        // Anything other than the next expected chunk is a resend or follows a lost chunk, so drop it
+        if (chunk->payload.offset == rx->next_offset && rx->next_offset + chunk->payload.length <= rx->total_length) {
+            memcpy(&rx->buffer[rx->next_offset], chunk->payload.data, chunk->payload.length);
+            rx->next_offset += chunk->payload.length;
+            if (rx->next_offset == rx->total_length) {
+                rx->complete = true;
+            }
+        }
+    }
+
+    split_shmem->bulk_ack.payload.channel     = chunk->payload.channel;
+    split_shmem->bulk_ack.payload.transfer_id = rx->transfer_id;
+    split_shmem->bulk_ack.payload.next_offset = rx->next_offset;
+    split_shmem->bulk_ack.checksum            = crc8(&split_shmem->bulk_ack.payload, sizeof(split_shmem->bulk_ack.payload));
+}
+
+static void bulk_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // Completion callbacks run from the main loop rather than the transport context
+    for (uint8_t channel = 0; channel < SPLIT_BULK_CHANNELS; ++channel) {
+        split_bulk_rx_t *rx = &bulk_rx[channel];
+
+        split_shared_memory_lock();
+        bool     complete = rx->complete;
+        uint16_t length   = rx->total_length;
+        rx->complete      = false;
+        split_shared_memory_unlock();
+
+        if (complete && rx->callback) {
+            rx->callback(channel, rx->buffer, length);
+        }
+    }
+}
+
+// clang-format off
+#    define TRANSACTIONS_BULK_MASTER() TRANSACTION_HANDLER_MASTER(bulk)
+#    define TRANSACTIONS_BULK_SLAVE() TRANSACTION_HANDLER_SLAVE(bulk)
+#    define TRANSACTIONS_BULK_REGISTRATIONS \
+    [PUT_BULK_CHUNK] = trans_initiator2target_initializer_cb(bulk_chunk, bulk_handlers_slave_chunk), \
+    [GET_BULK_ACK]   = trans_target2initiator_initializer(bulk_ack),
+// clang-format on
+
+#else // defined(SPLIT_BULK_TRANSFER_ENABLE)
+
+#    define TRANSACTIONS_BULK_MASTER()
+#    define TRANSACTIONS_BULK_SLAVE()
+#    define TRANSACTIONS_BULK_REGISTRATIONS
+
+#endif // defined(SPLIT_BULK_TRANSFER_ENABLE)
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -936,6 +1372,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_RGBLIGHT_REGISTRATIONS
     TRANSACTIONS_LED_MATRIX_REGISTRATIONS
     TRANSACTIONS_RGB_MATRIX_REGISTRATIONS
+    TRANSACTIONS_DELTA_SYNC_REGISTRATIONS
     TRANSACTIONS_WPM_REGISTRATIONS
     TRANSACTIONS_OLED_REGISTRATIONS
     TRANSACTIONS_ST7565_REGISTRATIONS
@@ -944,6 +1381,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BULK_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -955,6 +1393,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    transactions_sent = false;
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -974,9 +1413,21 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BULK_MASTER();
+    resync_pending = false;
     return true;
 }
 
+void transactions_resync(void) {
+    resync_pending = true;
+}
+
+bool transactions_probe(void) {
+    // The smallest transaction there is, so a missing target costs a single short timeout
+    uint8_t checksum;
+    return transport_execute_probe(GET_SLAVE_MATRIX_CHECKSUM, &checksum, sizeof(checksum), SPLIT_CONNECTION_PROBE_TIMEOUT);
+}
+
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
@@ -997,6 +1448,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_BULK_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
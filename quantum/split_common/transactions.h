@@ -45,9 +45,27 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+// send everything on the next pass, regardless of whether it changed
+void transactions_resync(void);
+// returns false if the slave doesn't answer a single minimal transaction within SPLIT_CONNECTION_PROBE_TIMEOUT
+bool transactions_probe(void);
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
 #define transaction_rpc_recv(transaction_id, target2initiator_buffer_size, target2initiator_buffer) transaction_rpc_exec(transaction_id, 0, NULL, target2initiator_buffer_size, target2initiator_buffer)
+
+#if defined(SPLIT_BULK_TRANSFER_ENABLE)
+typedef void (*split_bulk_complete_callback_t)(uint8_t channel, bool success);
+typedef void (*split_bulk_receive_callback_t)(uint8_t channel, const void *data, uint16_t length);
+
+// master side: queue `length` bytes for delivery, `data` must stay valid until the callback fires
+bool split_bulk_send(uint8_t channel, const void *data, uint16_t length, split_bulk_complete_callback_t callback);
+bool split_bulk_is_busy(uint8_t channel);
+void split_bulk_cancel(uint8_t channel);
+
+// slave side: where to place incoming transfers on `channel`, and who to notify once complete
+void split_bulk_register_receiver(uint8_t channel, void *buffer, uint16_t buffer_size, split_bulk_receive_callback_t callback);
+#endif // defined(SPLIT_BULK_TRANSFER_ENABLE)
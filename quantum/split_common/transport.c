@@ -86,6 +86,16 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+bool transport_execute_probe(int8_t id, void *target2initiator_buf, uint16_t target2initiator_length, uint16_t timeout_ms) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    size_t                    len   = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+    if (i2c_read_register(SLAVE_I2C_ADDRESS, trans->target2initiator_offset, split_trans_target2initiator_buffer(trans), len, timeout_ms) < 0) {
+        return false;
+    }
+    memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+    return true;
+}
+
 #else // USE_I2C
 
 #    include "serial.h"
@@ -119,6 +129,17 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+bool transport_execute_probe(int8_t id, void *target2initiator_buf, uint16_t target2initiator_length, uint16_t timeout_ms) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (!soft_serial_probe(id, timeout_ms)) {
+        return false;
+    }
+
+    size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+    memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+    return true;
+}
+
 #endif // USE_I2C
 
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -128,3 +149,11 @@ bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     transactions_slave(master_matrix, slave_matrix);
 }
+
+bool transport_probe(void) {
+    return transactions_probe();
+}
+
+void transport_resync(void) {
+    transactions_resync();
+}
@@ -22,6 +22,7 @@
 #include "progmem.h"
 #include "action_layer.h"
 #include "matrix.h"
+#include "split_delta_sync.h"
 
 #ifndef RPC_M2S_BUFFER_SIZE
 #    define RPC_M2S_BUFFER_SIZE 32
@@ -31,6 +32,42 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifdef SPLIT_BULK_TRANSFER_ENABLE
+// Payload bytes carried by each bulk transfer chunk
+#    ifndef SPLIT_BULK_CHUNK_SIZE
+#        define SPLIT_BULK_CHUNK_SIZE 32
+#    endif // SPLIT_BULK_CHUNK_SIZE
+
+// Max number of chunks sent per scan cycle before waiting for the slave to acknowledge
+#    ifndef SPLIT_BULK_WINDOW
+#        define SPLIT_BULK_WINDOW 4
+#    endif // SPLIT_BULK_WINDOW
+
+// Number of independent bulk transfer channels
+#    ifndef SPLIT_BULK_CHANNELS
+#        define SPLIT_BULK_CHANNELS 2
+#    endif // SPLIT_BULK_CHANNELS
+
+// Number of consecutive windows the slave may fail to acknowledge before a transfer is abandoned.
+// Scan cycles spent disconnected don't count, so transfers resume once the link is back.
+#    ifndef SPLIT_BULK_MAX_RETRIES
+#        define SPLIT_BULK_MAX_RETRIES 50
+#    endif // SPLIT_BULK_MAX_RETRIES
+#endif // SPLIT_BULK_TRANSFER_ENABLE
+
+#ifdef SPLIT_DELTA_SYNC_ENABLE
+// Max number of changed bytes carried by a delta update, larger changes resend the whole struct
+#    ifndef SPLIT_DELTA_MAX_PAYLOAD
+#        define SPLIT_DELTA_MAX_PAYLOAD 4
+#    endif // SPLIT_DELTA_MAX_PAYLOAD
+#endif // SPLIT_DELTA_SYNC_ENABLE
+
+// Time (in milliseconds) a connection probe waits for the slave to answer. Only the handshake has to make it
+// across, so this can be much shorter than the timeout used for regular transactions.
+#ifndef SPLIT_CONNECTION_PROBE_TIMEOUT
+#    define SPLIT_CONNECTION_PROBE_TIMEOUT 2
+#endif // SPLIT_CONNECTION_PROBE_TIMEOUT
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -38,7 +75,14 @@ void transport_slave_init(void);
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+// returns false if the slave doesn't answer, costing at most SPLIT_CONNECTION_PROBE_TIMEOUT
+bool transport_probe(void);
+// resend all synced state on the next transport_master()
+void transport_resync(void);
+
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+// read-only transaction that gives up if the slave doesn't answer within timeout_ms
+bool transport_execute_probe(int8_t id, void *target2initiator_buf, uint16_t target2initiator_length, uint16_t timeout_ms);
 
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
@@ -70,6 +114,14 @@ typedef struct _split_slave_encoder_sync_t {
 } split_slave_encoder_sync_t;
 #endif // ENCODER_ENABLE
 
+#ifndef DISABLE_SYNC_TIMER
+typedef struct _split_sync_timer_t {
+    uint32_t master_time;  // master clock, with half the last measured round trip added
+    uint32_t receive_time; // slave clock when master_time arrived, stamped on the slave
+    bool     locked;       // whether the slave's clock estimate has settled
+} split_sync_timer_t;
+#endif // DISABLE_SYNC_TIMER
+
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 typedef struct _split_layers_sync_t {
     layer_state_t layer_state;
@@ -143,6 +195,46 @@ typedef struct _rpc_sync_info_t {
 } rpc_sync_info_t;
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+#if defined(SPLIT_BULK_TRANSFER_ENABLE)
+_Static_assert(SPLIT_BULK_CHUNK_SIZE <= UINT8_MAX, "SPLIT_BULK_CHUNK_SIZE must fit the chunk length byte");
+
+typedef struct _split_bulk_chunk_t {
+    uint8_t checksum;
+    struct {
+        uint8_t  channel;
+        uint8_t  transfer_id; // 0 asks the slave for the last id it received, without carrying any data
+        uint16_t total_length;
+        uint16_t offset;
+        uint8_t  length;
+        uint8_t  data[SPLIT_BULK_CHUNK_SIZE];
+    } payload;
+} split_bulk_chunk_t;
+
+typedef struct _split_bulk_ack_t {
+    uint8_t checksum;
+    struct {
+        uint8_t  channel;
+        uint8_t  transfer_id;
+        uint16_t next_offset;
+    } payload;
+} split_bulk_ack_t;
+#endif // defined(SPLIT_BULK_TRANSFER_ENABLE)
+
+#if defined(SPLIT_DELTA_SYNC_ENABLE)
+// Each bit marks one changed block of the target transaction's buffer, blocks
+// are sized so that the whole buffer is covered by the bitmap.
+typedef uint8_t split_delta_map_t;
+
+typedef struct _split_delta_sync_t {
+    uint8_t checksum;
+    struct {
+        int8_t            transaction_id;
+        split_delta_map_t changed;
+        uint8_t           data[SPLIT_DELTA_MAX_PAYLOAD];
+    } payload;
+} split_delta_sync_t;
+#endif // defined(SPLIT_DELTA_SYNC_ENABLE)
+
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
@@ -163,7 +255,7 @@ typedef struct _split_shared_memory_t {
 #endif // ENCODER_ENABLE
 
 #ifndef DISABLE_SYNC_TIMER
-    uint32_t sync_timer;
+    split_sync_timer_t sync_timer;
 #endif // DISABLE_SYNC_TIMER
 
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
@@ -194,6 +286,10 @@ typedef struct _split_shared_memory_t {
     rgb_matrix_sync_t rgb_matrix_sync;
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
+#if defined(SPLIT_DELTA_SYNC_ENABLE)
+    split_delta_sync_t delta_sync;
+#endif // defined(SPLIT_DELTA_SYNC_ENABLE)
+
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
     uint8_t current_wpm;
 #endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
@@ -222,6 +318,11 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#if defined(SPLIT_BULK_TRANSFER_ENABLE)
+    split_bulk_chunk_t bulk_chunk;
+    split_bulk_ack_t   bulk_ack;
+#endif // defined(SPLIT_BULK_TRANSFER_ENABLE)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
@@ -27,15 +27,123 @@ SOFTWARE.
 #include "keyboard.h"
 
 #if defined(SPLIT_KEYBOARD) && !defined(DISABLE_SYNC_TIMER)
-volatile int32_t sync_timer_ms;
+
+// Time (in milliseconds) over which a measured offset error is smoothly slewed out
+#    ifndef SYNC_TIMER_SLEW_MS
+#        define SYNC_TIMER_SLEW_MS 250
+#    endif
+
+// Offset errors larger than this (in milliseconds) are stepped instead of slewed
+#    ifndef SYNC_TIMER_STEP_THRESHOLD_MS
+#        define SYNC_TIMER_STEP_THRESHOLD_MS 50
+#    endif
+
+// Samples need to be at least this far apart (in milliseconds) to refine the skew estimate,
+// as the 1ms timer resolution makes shorter baselines too noisy
+#    ifndef SYNC_TIMER_SKEW_MIN_INTERVAL_MS
+#        define SYNC_TIMER_SKEW_MIN_INTERVAL_MS 500
+#    endif
+
+// Clock skew beyond this (in parts per million) is considered bogus
+#    ifndef SYNC_TIMER_MAX_SKEW_PPM
+#        define SYNC_TIMER_MAX_SKEW_PPM 20000
+#    endif
+
+#    define SYNC_TIMER_SKEW_GAIN 4
+#    define SYNC_TIMER_LOCK_SAMPLES 3
+#    define SYNC_TIMER_MAX_EXTRAPOLATION_MS 60000
+
+_Static_assert(SYNC_TIMER_STEP_THRESHOLD_MS * 5 <= SYNC_TIMER_SLEW_MS, "SYNC_TIMER_SLEW_MS too short, slewing could make the clock run backwards");
+
+// The slave's view of the master clock is `local + offset`, where the offset is
+// modelled as a linear function of local time (skew), plus whatever error the
+// last sample revealed being spread out over SYNC_TIMER_SLEW_MS.
+static int32_t  sync_base_offset;
+static uint32_t sync_base_time;
+static int32_t  sync_skew_ppm;
+static int32_t  sync_slew_ms;
+static uint32_t sync_skew_time;
+static uint8_t  sync_samples;
+
+static int32_t sync_timer_offset_at(uint32_t local) {
+    uint32_t elapsed = local - sync_base_time;
+    if (elapsed > SYNC_TIMER_MAX_EXTRAPOLATION_MS) {
+        elapsed = SYNC_TIMER_MAX_EXTRAPOLATION_MS;
+    }
+
+    int32_t offset = sync_base_offset + ((int32_t)elapsed * sync_skew_ppm) / 1000000;
+    if (elapsed >= SYNC_TIMER_SLEW_MS) {
+        offset += sync_slew_ms;
+    } else {
+        offset += (sync_slew_ms * (int32_t)elapsed) / SYNC_TIMER_SLEW_MS;
+    }
+    return offset;
+}
+
+static void sync_timer_step(int32_t offset, uint32_t local) {
+    sync_base_offset = offset;
+    sync_base_time   = local;
+    sync_skew_time   = local;
+    sync_slew_ms     = 0;
+    sync_samples     = 1;
+}
 
 void sync_timer_init(void) {
-    sync_timer_ms = 0;
+    sync_base_offset = 0;
+    sync_base_time   = 0;
+    sync_skew_ppm    = 0;
+    sync_slew_ms     = 0;
+    sync_skew_time   = 0;
+    sync_samples     = 0;
 }
 
-void sync_timer_update(uint32_t time) {
+void sync_timer_sample(uint32_t master_time, uint32_t local_time) {
     if (is_keyboard_master()) return;
-    sync_timer_ms = time - timer_read32();
+
+    int32_t measured = (int32_t)(master_time - local_time);
+    if (sync_samples == 0) {
+        sync_timer_step(measured, local_time);
+        return;
+    }
+
+    int32_t current = sync_timer_offset_at(local_time);
+    int32_t error   = measured - current;
+    if (error > SYNC_TIMER_STEP_THRESHOLD_MS || error < -SYNC_TIMER_STEP_THRESHOLD_MS) {
+        sync_timer_step(measured, local_time);
+        return;
+    }
+
+    // Whatever error accumulated since the last skew update is mostly down to the
+    // skew estimate being off, so nudge it by a fraction of the implied frequency error
+    uint32_t interval = local_time - sync_skew_time;
+    if (interval >= SYNC_TIMER_SKEW_MIN_INTERVAL_MS) {
+        if (interval > SYNC_TIMER_MAX_EXTRAPOLATION_MS) {
+            interval = SYNC_TIMER_MAX_EXTRAPOLATION_MS;
+        }
+        sync_skew_ppm += (error * (1000000 / SYNC_TIMER_SKEW_GAIN)) / (int32_t)interval;
+        if (sync_skew_ppm > SYNC_TIMER_MAX_SKEW_PPM) {
+            sync_skew_ppm = SYNC_TIMER_MAX_SKEW_PPM;
+        } else if (sync_skew_ppm < -SYNC_TIMER_MAX_SKEW_PPM) {
+            sync_skew_ppm = -SYNC_TIMER_MAX_SKEW_PPM;
+        }
+        sync_skew_time = local_time;
+    }
+
+    // Continue from where the clock currently is, and slew out the remaining error
+    sync_base_offset = current;
+    sync_base_time   = local_time;
+    sync_slew_ms     = error;
+    if (sync_samples < UINT8_MAX) {
+        sync_samples++;
+    }
+}
+
+void sync_timer_update(uint32_t time) {
+    sync_timer_sample(time, timer_read32());
+}
+
+bool sync_timer_is_locked(void) {
+    return is_keyboard_master() || sync_samples >= SYNC_TIMER_LOCK_SAMPLES;
 }
 
 uint16_t sync_timer_read(void) {
@@ -45,7 +153,8 @@ uint16_t sync_timer_read(void) {
 
 uint32_t sync_timer_read32(void) {
     if (is_keyboard_master()) return timer_read32();
-    return sync_timer_ms + timer_read32();
+    uint32_t local = timer_read32();
+    return local + sync_timer_offset_at(local);
 }
 
 uint16_t sync_timer_elapsed(uint16_t last) {
@@ -26,6 +26,7 @@ SOFTWARE.
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "timer.h"
 
 #ifdef __cplusplus
@@ -35,6 +36,8 @@ extern "C" {
 #if defined(SPLIT_KEYBOARD) && !defined(DISABLE_SYNC_TIMER)
 void     sync_timer_init(void);
 void     sync_timer_update(uint32_t time);
+void     sync_timer_sample(uint32_t master_time, uint32_t local_time);
+bool     sync_timer_is_locked(void);
 uint16_t sync_timer_read(void);
 uint32_t sync_timer_read32(void);
 uint16_t sync_timer_elapsed(uint16_t last);
@@ -43,6 +46,8 @@ uint32_t sync_timer_elapsed32(uint32_t last);
 #    define sync_timer_init()
 #    define sync_timer_clear()
 #    define sync_timer_update(t)
+#    define sync_timer_sample(m, l)
+#    define sync_timer_is_locked() true
 #    define sync_timer_read() timer_read()
 #    define sync_timer_read32() timer_read32()
 #    define sync_timer_elapsed(t) timer_elapsed(t)